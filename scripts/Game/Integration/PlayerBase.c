@@ -33,6 +33,7 @@ modded class SCR_CharacterControllerComponent
         loc.drainParams.appliedSpeedLimitMs = m_fAppliedSpeedLimitMs;
         loc.drainParams.effectiveCriticalPowerWatts = -1.0;
         loc.drainParams.wPrimePool01 = 1.0;
+        loc.drainParams.metabolicContext = m_pMetabolicTickContext;
         if (m_pAnaerobicBurst)
         {
             SCR_RSS_CriticalPowerModel cpForDrain = m_pAnaerobicBurst.GetCpModel();
@@ -72,7 +73,8 @@ modded class SCR_CharacterControllerComponent
                 loc.terrainFactor,
                 loc.effectiveMovementPhase,
                 loc.wPrimePool01Dbg,
-                loc.isSprintActive);
+                loc.isSprintActive,
+                m_pMetabolicTickContext);
         }
 
         loc.needLocalDebugBatch = false;
@@ -118,29 +120,13 @@ modded class SCR_CharacterControllerComponent
             loc.metabPowerMetDbg,
             loc.metabPowerRawDbg,
             loc.metabCpDbg,
-            loc.metabAerobicDbg);
+            loc.metabAerobicDbg,
+            m_pMetabolicTickContext);
+
+        if (!m_pRssTickRates)
+            m_pRssTickRates = new StaminaTickRates();
+        m_pRssTickRates.valid = false;
 
-        loc.finalDrainDbg = SCR_RSS_StaminaNetRate.ComputeFinalDrainRatePerTick(
-            loc.useSwimmingModel,
-            loc.currentSpeed,
-            loc.totalDrainRate,
-            m_pEpocState,
-            false);
-        loc.metabolicNetDbg = SCR_RSS_StaminaNetRate.GetNetStaminaRatePerSecond(
-            loc.staminaBeforeUpdate,
-            loc.useSwimmingModel,
-            loc.currentSpeed,
-            loc.totalDrainRate,
-            loc.baseDrainRateByVelocity,
-            loc.baseDrainRateByVelocityForModule,
-            loc.heatStressMultiplier,
-            m_pEpocState,
-            m_pEncumbranceCache,
-            m_pExerciseTracker,
-            this,
-            m_pEnvironmentFactor,
-            false) / 5.0;
-        
         loc.overspeedExtraPerSec = 0.0;
         if (!loc.useSwimmingModel)
         {
@@ -192,7 +178,8 @@ modded class SCR_CharacterControllerComponent
                 m_pFatigueSystem,
                 this,
                 m_pEnvironmentFactor,
-                loc.timeDeltaSec);
+                loc.timeDeltaSec,
+                m_pRssTickRates);
             
             if (loc.overspeedExtraPerSec > 0.000001)
                 newTargetStamina = newTargetStamina - loc.overspeedExtraPerSec * loc.timeDeltaSec;
@@ -230,6 +217,34 @@ modded class SCR_CharacterControllerComponent
             loc.staminaPercent = newTargetStamina;
         }
 
+        // 无体力组件时 UpdateStaminaValue 未运行：按同一输入补算一次，保证记录始终有效
+        if (!m_pRssTickRates.valid)
+        {
+            SCR_RSS_StaminaNetRate.PublishTickRates(
+                m_pRssTickRates,
+                loc.staminaBeforeUpdate,
+                SCR_RSS_StaminaNetRate.ComputeRecoveryRatePerTick(
+                    loc.staminaBeforeUpdate,
+                    loc.currentSpeed,
+                    loc.baseDrainRateByVelocity,
+                    loc.baseDrainRateByVelocityForModule,
+                    loc.heatStressMultiplier,
+                    m_pEpocState,
+                    m_pEncumbranceCache,
+                    m_pExerciseTracker,
+                    this,
+                    m_pEnvironmentFactor,
+                    false),
+                SCR_RSS_StaminaNetRate.ComputeFinalDrainRatePerTick(
+                    loc.useSwimmingModel,
+                    loc.currentSpeed,
+                    loc.totalDrainRate,
+                    m_pEpocState,
+                    false));
+        }
+        loc.finalDrainDbg = m_pRssTickRates.finalDrainPerTick;
+        loc.metabolicNetDbg = m_pRssTickRates.recoveryPerTick - m_pRssTickRates.finalDrainPerTick;
+
         if (loc.isPlayer && m_pCardioDrive)
         {
             float cardioCp = loc.drainParams.effectiveCriticalPowerWatts;
@@ -245,7 +260,6 @@ modded class SCR_CharacterControllerComponent
                 cardioCp,
                 cardioWPrime,
                 loc.staminaPercent);
-            m_pCardioDrive.Tick(loc.currentTime);
         }
 
         if (loc.isPlayer && m_pUISignalBridge)
@@ -313,7 +327,8 @@ modded class SCR_CharacterControllerComponent
                     loc.totalWeightWithWetAndBody,
                     loc.gradePercent,
                     loc.terrainFactor,
-                    loc.phaseNow);
+                    loc.phaseNow,
+                    m_pMetabolicTickContext);
                 loc.capShrinkDbg = m_pFatigueSystem.EstimateCapShrinkPerSecond(
                     powerFat,
                     loc.currentWeight,
@@ -374,6 +389,7 @@ modded class SCR_CharacterControllerComponent
             loc.targetStaCapDbg,
             loc.capShrinkDbg,
             loc.epocActiveDbg);
+        loc.debugTick.rates = m_pRssTickRates;
         SCR_RSS_UpdateLoopDebugOutput.OutputPlayerStaminaAndHints(
             this,
             loc.owner,
@@ -440,6 +456,8 @@ modded class SCR_CharacterControllerComponent
 
     protected ref SCR_RSS_CollapseTransition m_pCollapseTransition;
     protected ref SCR_RSS_SlopeSpeedTransition m_pSlopeSpeedTransition;
+    //! 高度图预测坡度（CP 限速用，首次使用时创建）
+    protected ref SCR_RSS_GradeEstimator m_pGradeEstimator;
     protected ref SCR_RSS_SprintBlockSpeedTransition m_pSprintBlockSpeedTransition;
     
     protected ref SCR_RSS_ExerciseTracker m_pExerciseTracker;
@@ -459,6 +477,7 @@ modded class SCR_CharacterControllerComponent
     protected ref SCR_RSS_BreathSoundDriver m_pBreathSoundDriver;
     protected ref SCR_RSS_HeartbeatSoundDriver m_pHeartbeatSoundDriver;
     protected ref SCR_RSS_CardioDrive m_pCardioDrive;
+    protected ref SCR_RSS_PresentationClock m_pPresentationClock;
     
     protected ref SCR_RSS_EpocState m_pEpocState;
     
@@ -487,8 +506,29 @@ modded class SCR_CharacterControllerComponent
     protected int m_iCombatStimDelayInjectionCount = 0;
     //! 注射 Buff 前记录的 GetBleedingScale()，用于阶段结束时还原；-1 表示未处于 Buff
     protected float m_fRSS_CombatStimBleedingBaseline = -1.0;
+    //! 新增流血效果后待按当前倍率重设；与安全计时 m_fRSS_CombatStimBleedingNextCheckAt 共同驱动
+    protected bool m_bRSS_CombatStimBleedingDirty = false;
+    protected float m_fRSS_CombatStimBleedingNextCheckAt = -1.0;
     
     protected ref SCR_RSS_MudSlipRunner m_pMudSlipRunner;
+    //! 限速/速度钳的 tick 内暂存与去重落盘（见 SCR_RSS_SpeedOutputStage）
+    protected ref SCR_RSS_SpeedOutputStage m_pSpeedOutputStage;
+    //! 单 tick 代谢量（功率记忆 / TickPower 后 CP 与武装态快照）
+    protected ref SCR_RSS_MetabolicTickContext m_pMetabolicTickContext;
+    //! 真实 tick 间隔与玩家静止降频（见 SCR_RSS_TickScheduler）
+    protected ref SCR_RSS_TickScheduler m_pTickScheduler;
+    protected int m_iRssTickStance = -1;
+    //! 上一 tick 的恢复/消耗/净率（协调器发布；HUD、调试、API 只读）
+    protected ref StaminaTickRates m_pRssTickRates;
+    //! 外部 API 每实体快照（见 SCR_RSS_API）与本地 tick 号
+    protected ref RSS_EntitySnapshot m_pRssApiSnapshot;
+    protected int m_iRssTickId = 0;
+    //! 状态边沿事件（有订阅需求时才创建；见 SCR_RSS_StateEvents）
+    protected ref SCR_RSS_StateEvents m_pRssStateEvents;
+    //! 服务器 AI 在 SCR_RSS_AiLodRegistry 中的槽位（-1 = 未登记）
+    protected int m_iRssAiSlot = -1;
+    //! 已登记到专服 W′ 批量 pass（SCR_RSS_WPrimeServerTick）
+    protected bool m_bRssWPrimeServerRegistered = false;
     protected float m_fRssMudSlipCameraShake01 = 0.0;
     protected float m_fLastRssSpeedMultiplierApplied = 1.0;
     protected float m_fLastRssEngineBaseForLimit = 0.0;
@@ -555,6 +595,7 @@ modded class SCR_CharacterControllerComponent
             m_pBreathSoundDriver = null;
             m_pHeartbeatSoundDriver = null;
             m_pCardioDrive = null;
+            m_pPresentationClock = null;
             m_pEpocState = null;
             m_pNetworkSyncManager = null;
             return;
@@ -569,6 +610,8 @@ modded class SCR_CharacterControllerComponent
         {
             SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(ownerForSpeed, 1.0);
             RSS_RestoreNativeMovementMaxSpeed(ownerForSpeed);
+            if (m_pSpeedOutputStage)
+                m_pSpeedOutputStage.Invalidate();
         }
 
         m_bRssStaminaLoopActive = false;
@@ -596,6 +639,8 @@ modded class SCR_CharacterControllerComponent
             m_pHeartbeatSoundDriver.Cleanup();
         if (m_pCardioDrive)
             m_pCardioDrive.Reset();
+        if (m_pPresentationClock)
+            m_pPresentationClock.Reset();
 
         m_pCachedOwnerCharacter = null;
         m_pStaminaComponent = null;
@@ -617,6 +662,7 @@ modded class SCR_CharacterControllerComponent
         m_pBreathSoundDriver = null;
         m_pHeartbeatSoundDriver = null;
         m_pCardioDrive = null;
+        m_pPresentationClock = null;
         m_pEpocState = null;
         m_pNetworkSyncManager = null;
         if (m_pAIManager)
@@ -642,11 +688,80 @@ modded class SCR_CharacterControllerComponent
     }
 
 
+    //! 上一 tick 实际使用的体力速率；尚未 tick 过时返回 null
+    StaminaTickRates RSS_GetTickRates()
+    {
+        if (m_pRssTickRates && m_pRssTickRates.valid)
+            return m_pRssTickRates;
+        return null;
+    }
+
     bool HasRssData()
     {
         return SCR_PlayerBaseRssApiHelper.HasRssData(m_pStaminaComponent, m_pEnvironmentFactor);
     }
 
+    //! 外部 API 快照（每实体一份，惰性创建）
+    RSS_EntitySnapshot RSS_GetApiSnapshot()
+    {
+        if (!m_pRssApiSnapshot)
+        {
+            m_pRssApiSnapshot = new RSS_EntitySnapshot();
+            m_pRssApiSnapshot.entity = GetOwner();
+        }
+        return m_pRssApiSnapshot;
+    }
+
+    //! 状态边沿事件（惰性创建；创建后每个 tick 末判定一次）
+    SCR_RSS_StateEvents RSS_GetStateEvents()
+    {
+        if (!m_pRssStateEvents)
+            m_pRssStateEvents = new SCR_RSS_StateEvents();
+        return m_pRssStateEvents;
+    }
+
+    //! tick 末：有订阅时比较本 tick 状态并触发边沿
+    protected void RSS_EvaluateStateEvents(IEntity owner)
+    {
+        if (!m_pRssStateEvents || !HasRssData())
+            return;
+        m_pRssStateEvents.Evaluate(
+            owner,
+            GetRssStaminaPercent(),
+            GetRssIsExhausted(),
+            RSS_IsWPrimeDepletedForEvents(),
+            !GetRssSprintAllowed(),
+            RSS_GetAIStaminaState());
+    }
+
+    //! W′ 耗尽态：服务器本 tick 推进过 W′ 时读 TickPower 后快照；
+    //! 客户端（玩家 tick 所在端）不推进 W′，读复制池——RplProp 回调已按施密特刷新 CP 模型武装态，无模型时按复制池值判定
+    protected bool RSS_IsWPrimeDepletedForEvents()
+    {
+        if (m_pMetabolicTickContext && m_pMetabolicTickContext.IsPostTickCaptured())
+            return !m_pMetabolicTickContext.IsOverspeedArmed();
+        if (m_pAnaerobicBurst && m_pAnaerobicBurst.GetCpModel())
+            return !m_pAnaerobicBurst.GetCpModel().IsOverspeedArmed();
+        return !SCR_RSS_DrainCalculator.IsWPrimePoolAvailableForOverspeed(m_fReplAnaerobicPool);
+    }
+
+    //! 本地体力 tick 号（每次 UpdateSpeedBasedOnStamina 递增）
+    int RSS_GetTickId()
+    {
+        return m_iRssTickId;
+    }
+
+    //! 快照去重键：本地 tick 在跑时为 tick 号；否则（服务器上的远端玩家等）按世界时毫秒，同帧只填一次
+    int RSS_GetApiSnapshotStamp()
+    {
+        if (m_bRssStaminaLoopActive && !m_bIsDeleted)
+            return m_iRssTickId;
+        if (!GetGame() || !GetGame().GetWorld())
+            return -1;
+        int worldMs = GetGame().GetWorld().GetWorldTime();
+        return -2 - worldMs;
+    }
+
     float GetRssStaminaPercent()
     {
         return SCR_PlayerBaseRssApiHelper.ClampStaminaPercent(m_pStaminaComponent);
@@ -857,6 +972,8 @@ modded class SCR_CharacterControllerComponent
         m_fCachedEngineMaxRunMs = m_pAnimComponent.GetMaxSpeed(1.0, 0.0, 2);
         m_fCachedEngineMaxSprintMs = m_pAnimComponent.GetMaxSpeed(1.0, 0.0, 3);
         SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(ownerEnt, restoreMult);
+        if (m_pSpeedOutputStage)
+            m_pSpeedOutputStage.Invalidate();
         m_bEngineTopUncappedCalibrated = true;
     }
 
@@ -1036,14 +1153,14 @@ modded class SCR_CharacterControllerComponent
             this);
     }
 
-    void OnItemRemovedFromInventory()
+    void OnItemRemovedFromInventory(IEntity item)
     {
-        SCR_PlayerBaseInventoryHelper.UpdateEncumbranceCache(m_pEncumbranceCache);
+        SCR_PlayerBaseInventoryHelper.ApplyEncumbranceItemDelta(m_pEncumbranceCache, item, -1.0);
     }
 
-    void OnItemAddedToInventory()
+    void OnItemAddedToInventory(IEntity item)
     {
-        SCR_PlayerBaseInventoryHelper.UpdateEncumbranceCache(m_pEncumbranceCache);
+        SCR_PlayerBaseInventoryHelper.ApplyEncumbranceItemDelta(m_pEncumbranceCache, item, 1.0);
     }
 
     void RSS_TriggerMudSlipRagdoll()
@@ -1144,6 +1261,29 @@ modded class SCR_CharacterControllerComponent
         return m_fSmoothedGradePercentForSpeed;
     }
 
+    //! 本实体的坡度估计器（惰性创建）；主循环 SampleSlope 用它取移动中的高度格坡度
+    SCR_RSS_GradeEstimator RSS_GetGradeEstimator()
+    {
+        if (!m_pGradeEstimator)
+            m_pGradeEstimator = new SCR_RSS_GradeEstimator();
+        return m_pGradeEstimator;
+    }
+
+    //! CP 限速用坡度：EMA 照常推进（Phase A 物理钳读取）；本 tick 坡度采样来自高度格时改取其平滑坡度，
+    //! 并按前瞻坡度提前修正，上坡前先降巡航顶而不是上坡后才反应（复用采样时的同一次估计，不再查地形）。
+    //! 室内抑制、攀爬、跳跃、静止或采样走法线时退回 EMA（原始坡度此时已为 0 或来自法线）。
+    float RSS_GradePercentForSpeedCap(float rawGradePercent, float currentTimeSec, SCR_RSS_SlopeSample sample, float currentSpeed)
+    {
+        float smoothed = RSS_SmoothGradePercentForSpeed(rawGradePercent, currentTimeSec);
+        if (!sample || !sample.m_bFromHeightmap || !sample.m_pGradeEstimate || currentSpeed <= 0.05)
+            return smoothed;
+        if (IsClimbing())
+            return smoothed;
+        if (m_pJumpVaultDetector && m_pJumpVaultDetector.GetJumpInputTriggered())
+            return smoothed;
+        return SCR_RSS_SpeedBridge.ClampGradePercentForMetabolicSpeed(SCR_RSS_GradeEstimator.BlendForSpeedCap(sample.m_pGradeEstimate));
+    }
+
     //! 坡度 EMA：供 CP 反解限速，避免下坡法线噪声拧速度
     float RSS_SmoothGradePercentForSpeed(float rawGradePercent, float currentTimeSec)
     {
@@ -1213,6 +1353,73 @@ modded class SCR_CharacterControllerComponent
         return SCR_PlayerBaseMovementHelper.HasSwimInput(m_pAnimComponent);
     }
 
+    //! 玩家专属子系统按需补建（OnInit 时已受控，或 AI 被玩家接管）；已存在的不重建
+    protected void RSS_EnsurePlayerSubsystems(IEntity owner)
+    {
+        if (!m_pJumpVaultDetector)
+        {
+            m_pJumpVaultDetector = new SCR_RSS_JumpVaultDetector();
+            m_pJumpVaultDetector.Initialize();
+        }
+        if (!m_pStanceTransitionManager)
+        {
+            m_pStanceTransitionManager = new SCR_RSS_StanceTransitionManager();
+            m_pStanceTransitionManager.Initialize();
+            m_pStanceTransitionManager.SetInitialStance(GetStance());
+        }
+        if (!m_pUISignalBridge && owner)
+        {
+            m_pUISignalBridge = new SCR_RSS_UISignalBridge();
+            m_pUISignalBridge.Init(owner);
+        }
+        if (!m_pBreathSoundDriver && SCR_RSS_Constants.V6_BREATH_SOUND_ENABLED)
+            m_pBreathSoundDriver = new SCR_RSS_BreathSoundDriver();
+        if (!m_pHeartbeatSoundDriver && SCR_RSS_Constants.V6_HEARTBEAT_SOUND_ENABLED)
+            m_pHeartbeatSoundDriver = new SCR_RSS_HeartbeatSoundDriver();
+        if (!m_pCardioDrive)
+            m_pCardioDrive = new SCR_RSS_CardioDrive();
+        if (!m_pPresentationClock)
+            m_pPresentationClock = new SCR_RSS_PresentationClock();
+        RSS_EnsureNetworkSyncManager();
+    }
+
+    //! 登记表 swap-remove 搬动本实体时回调
+    void RSS_SetAiRegistrySlot(int slot)
+    {
+        m_iRssAiSlot = slot;
+    }
+
+    int RSS_GetAiRegistrySlot()
+    {
+        return m_iRssAiSlot;
+    }
+
+    //! 服务器 AI 登记到 SCR_RSS_AiLodRegistry（已登记则忽略）
+    protected void RSS_AcquireAiRegistrySlot()
+    {
+        if (m_bIsDeleted || m_iRssAiSlot >= 0 || !Replication.IsServer() || IsPlayerControlled())
+            return;
+        m_iRssAiSlot = SCR_RSS_AiLodRegistry.Get().Acquire(this, GetOwner());
+    }
+
+    //! 删除或被玩家接管时注销
+    protected void RSS_ReleaseAiRegistrySlot()
+    {
+        if (m_iRssAiSlot < 0)
+            return;
+        SCR_RSS_AiLodRegistry.Get().Release(m_iRssAiSlot, this);
+        m_iRssAiSlot = -1;
+    }
+
+    //! 网络同步管理器：玩家本地随专属子系统创建；服务器在首个客户端上报时创建
+    protected void RSS_EnsureNetworkSyncManager()
+    {
+        if (m_pNetworkSyncManager)
+            return;
+        m_pNetworkSyncManager = new SCR_RSS_NetworkSyncManager();
+        m_pNetworkSyncManager.Initialize();
+    }
+
     override void OnControlledByPlayer(IEntity owner, bool controlled)
     {
         super.OnControlledByPlayer(owner, controlled);
@@ -1225,6 +1432,11 @@ modded class SCR_CharacterControllerComponent
 
         if (controlled)
         {
+            RSS_ReleaseAiRegistrySlot();
+            // 仅对已完成 OnInit 的实体补建（未初始化的由 OnInit 按受控状态建）
+            if (m_pEnvironmentFactor)
+                RSS_EnsurePlayerSubsystems(owner);
+
             if (!m_pStaminaComponent)
             {
                 m_pStaminaComponent = SCR_CharacterStaminaComponent.Cast(GetStaminaComponent());
@@ -1308,8 +1520,12 @@ modded class SCR_CharacterControllerComponent
     {
         super.OnPrepareControls(owner, am, dt, player);
 
-        if (Replication.IsServer() && IsPlayerControlled() && !ShouldProcessStaminaUpdate())
-            RSS_MaybeServerTickAnaerobic();
+        // 专服补 tick 由批量 pass 推进；此处只在首次需要时登记
+        if (!m_bRssWPrimeServerRegistered && Replication.IsServer() && IsPlayerControlled() && !ShouldProcessStaminaUpdate())
+        {
+            m_bRssWPrimeServerRegistered = true;
+            SCR_RSS_WPrimeServerTick.Get().Register(this);
+        }
 
         if (owner == SCR_PlayerController.GetLocalControlledEntity())
             RSS_ApplySprintGateOnPrepareControls(am);
@@ -1319,7 +1535,7 @@ modded class SCR_CharacterControllerComponent
 
         RSS_UpdatePresentationSoundDrivers();
 
-        // 每帧重申机械限速（负重/坡度）。默认不物理钳、不代谢伺服速度。
+        // 每帧重申机械限速（负重/坡度），与上次写入相同则跳过。默认不物理钳、不代谢伺服速度。
         if (SCR_RSS_SpeedBridge.IsStaminaSpeedPressEnabled()
             && m_fAppliedSpeedLimitMs > 0.05
             && !SCR_PlayerBaseMovementHelper.IsInVehicle(m_pCompartmentAccess))
@@ -1329,9 +1545,19 @@ modded class SCR_CharacterControllerComponent
                 limitFrac = 0.01;
             if (limitFrac > 1.0)
                 limitFrac = 1.0;
-            SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(owner, limitFrac);
-            if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
-                SCR_RSS_SpeedBridge.ClampOwnerHorizontalSpeed(owner, m_fAppliedSpeedLimitMs);
+            if (m_pSpeedOutputStage && GetGame().GetWorld())
+            {
+                float nowSec = GetGame().GetWorld().GetWorldTime() / 1000.0;
+                m_pSpeedOutputStage.WriteLimit(owner, limitFrac, nowSec);
+                if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
+                    m_pSpeedOutputStage.WriteHardClamp(owner, m_fAppliedSpeedLimitMs, nowSec);
+            }
+            else
+            {
+                SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(owner, limitFrac);
+                if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
+                    SCR_RSS_SpeedBridge.ClampOwnerHorizontalSpeed(owner, m_fAppliedSpeedLimitMs);
+            }
         }
         
         bool isInVehicle = SCR_PlayerBaseMovementHelper.IsInVehicle(m_pCompartmentAccess);
@@ -1342,6 +1568,39 @@ modded class SCR_CharacterControllerComponent
             if (IsRssDebugEnabled())
                 Print("[RSS] OnPrepareControls 检测到跳跃输入！/ OnPrepareControls Detected Jump Input!");
         }
+
+        if (m_pTickScheduler && m_pTickScheduler.IsIdleRate() && RSS_HasTickWakeInput(am))
+            RSS_PromoteTickRate();
+    }
+
+    //! 降频中的唤醒条件：移动/冲刺/跳跃输入、姿态变化或已有位移
+    protected bool RSS_HasTickWakeInput(ActionManager am)
+    {
+        if (am.GetActionTriggered("Jump"))
+            return true;
+        if (Math.AbsFloat(am.GetActionValue("CharacterForward")) > 0.05 || Math.AbsFloat(am.GetActionValue("CharacterRight")) > 0.05)
+            return true;
+        if (am.GetActionValue("CharacterSprint") > 0.0)
+            return true;
+        if (GetStance() != m_iRssTickStance)
+            return true;
+        float wakeSpeed = SCR_RSS_TickScheduler.IDLE_SPEED_MS;
+        return GetVelocity().LengthSq() > wakeSpeed * wakeSpeed;
+    }
+
+    //! 由降频立即升回全速：作废挂起的慢回调并插一次 tick，之后由 tick 末按全速续排
+    void RSS_PromoteTickRate()
+    {
+        if (!m_pTickScheduler || !GetGame())
+            return;
+        if (m_pTickScheduler.Promote())
+            GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.Tick, 0, false, this);
+    }
+
+    //! 降频回调的代号是否仍有效（Promote 之后挂起的慢回调作废）
+    bool RSS_IsTickGenerationCurrent(int generation)
+    {
+        return m_pTickScheduler && m_pTickScheduler.GetGeneration() == generation;
     }
 
     protected bool ShouldProcessStaminaUpdate()
@@ -1385,12 +1644,21 @@ modded class SCR_CharacterControllerComponent
             return;
         m_bIsDeleted = true;
         m_bRssStaminaLoopActive = false;
+        SCR_RSS_API.UnregisterManaged(this);
+        RSS_ReleaseAiRegistrySlot();
+        if (m_bRssWPrimeServerRegistered)
+        {
+            m_bRssWPrimeServerRegistered = false;
+            SCR_RSS_WPrimeServerTick.Get().Unregister(this);
+        }
 
         IEntity ownerForSpeed = GetOwner();
         if (ownerForSpeed)
         {
             SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(ownerForSpeed, 1.0);
             RSS_RestoreNativeMovementMaxSpeed(ownerForSpeed);
+            if (m_pSpeedOutputStage)
+                m_pSpeedOutputStage.Invalidate();
         }
 
         RSS_RemoveScheduledCallbacks();
@@ -1403,6 +1671,8 @@ modded class SCR_CharacterControllerComponent
             m_pHeartbeatSoundDriver.Cleanup();
         if (m_pCardioDrive)
             m_pCardioDrive.Reset();
+        if (m_pPresentationClock)
+            m_pPresentationClock.Reset();
         
         m_pCachedOwnerCharacter = null;
         m_pStaminaComponent = null;
@@ -1425,6 +1695,7 @@ modded class SCR_CharacterControllerComponent
         m_pBreathSoundDriver = null;
         m_pHeartbeatSoundDriver = null;
         m_pCardioDrive = null;
+        m_pPresentationClock = null;
         m_pEpocState = null;
         m_pNetworkSyncManager = null;
     }
@@ -1468,17 +1739,6 @@ modded class SCR_CharacterControllerComponent
             m_pStaminaComponent.SetTargetStamina(SCR_RSS_MetabolismMath.INITIAL_STAMINA_AFTER_ACFT);
         }
         
-        m_pJumpVaultDetector = new SCR_RSS_JumpVaultDetector();
-        if (m_pJumpVaultDetector)
-            m_pJumpVaultDetector.Initialize();
-        
-        m_pStanceTransitionManager = new SCR_RSS_StanceTransitionManager();
-        if (m_pStanceTransitionManager)
-        {
-            m_pStanceTransitionManager.Initialize();
-            m_pStanceTransitionManager.SetInitialStance(GetStance());
-        }
-        
         m_pExerciseTracker = new SCR_RSS_ExerciseTracker();
         if (m_pExerciseTracker)
         {
@@ -1504,8 +1764,6 @@ modded class SCR_CharacterControllerComponent
         if (m_pTerrainDetector)
             m_pTerrainDetector.Initialize(!IsPlayerControlled());
         
-        m_pMudSlipRunner = new SCR_RSS_MudSlipRunner();
-
         m_pEnvironmentFactor = new SCR_RSS_EnvironmentFactor();
         if (m_pEnvironmentFactor)
         {
@@ -1520,9 +1778,6 @@ modded class SCR_CharacterControllerComponent
             }
         }
         
-        if (!m_pAIManager)
-            m_pAIManager = new SCR_RSS_AIManager();
-
         if (!m_pAnaerobicBurst)
             m_pAnaerobicBurst = new SCR_RSS_AnaerobicBurst();
         if (!m_pStaminaState)
@@ -1552,25 +1807,13 @@ modded class SCR_CharacterControllerComponent
             m_pAnimComponent = character.GetAnimationComponent();
         }
         
-        m_pUISignalBridge = new SCR_RSS_UISignalBridge();
-        if (m_pUISignalBridge)
-            m_pUISignalBridge.Init(owner);
-
-        if (SCR_RSS_Constants.V6_BREATH_SOUND_ENABLED)
-            m_pBreathSoundDriver = new SCR_RSS_BreathSoundDriver();
-        else
-            m_pBreathSoundDriver = null;
-        if (SCR_RSS_Constants.V6_HEARTBEAT_SOUND_ENABLED)
-            m_pHeartbeatSoundDriver = new SCR_RSS_HeartbeatSoundDriver();
-        else
-            m_pHeartbeatSoundDriver = null;
-        m_pCardioDrive = new SCR_RSS_CardioDrive();
-        
         m_pEpocState = new SCR_RSS_EpocState();
-        
-        m_pNetworkSyncManager = new SCR_RSS_NetworkSyncManager();
-        if (m_pNetworkSyncManager)
-            m_pNetworkSyncManager.Initialize();
+
+        // 玩家专属子系统（跳跃/姿态、UI、心肺/呼吸音、网络同步）：AI 不建，接管时在 OnControlledByPlayer 补建
+        if (IsPlayerControlled())
+            RSS_EnsurePlayerSubsystems(owner);
+
+        SCR_RSS_API.RegisterManaged(this);
         
         if (GetGame() && GetGame().GetCallqueue())
         {
@@ -1658,31 +1901,40 @@ modded class SCR_CharacterControllerComponent
         return m_pAnaerobicBurst.GetCooldownRemainingSec(t);
     }
 
-    //! 专服上玩家体力主循环不在服务端跑时，补 tick 无氧池（权威写 RplProp）。
-    void RSS_MaybeServerTickAnaerobic()
+    //! 专服 W′ 批量 pass 的单实体步进（SCR_RSS_WPrimeServerTick 调用，权威写 RplProp）。
+    //! 只在量化池值或冷却截止变化时 BumpMe；返回 false 表示不再需要补 tick，应移出登记表。
+    bool RSS_ServerWPrimePassStep(float currentTime, float idlePowerW, float sprintPowerW)
     {
+        if (m_bIsDeleted || !IsPlayerControlled() || ShouldProcessStaminaUpdate())
+        {
+            m_bRssWPrimeServerRegistered = false;
+            return false;
+        }
+
         float lastUpdate = m_fLastStaminaUpdateTime;
-        float replPool = m_fReplAnaerobicPool;
-        float replCd = m_fReplAnaerobicCooldownUntil;
-        bool didTick = SCR_RSS_WPrimeServerTick.MaybeTick(
-            Replication.IsServer(),
-            IsPlayerControlled(),
-            ShouldProcessStaminaUpdate(),
+        bool didTick = SCR_RSS_WPrimeServerTick.TickOne(
             m_pAnaerobicBurst,
             m_pStaminaState,
             IsSprinting() || (GetCurrentMovementPhase() == 3),
             GetRssAerobicPercent(),
-            GetSpeedUpdateIntervalMs() / 1000.0,
-            lastUpdate,
-            replPool,
-            replCd);
+            currentTime,
+            idlePowerW,
+            sprintPowerW,
+            lastUpdate);
         if (!didTick)
-            return;
-
+            return true;
         m_fLastStaminaUpdateTime = lastUpdate;
+
+        float replPool = m_fReplAnaerobicPool;
+        float replCd = m_fReplAnaerobicCooldownUntil;
+        SCR_RSS_NetworkSyncManager.ReadAnaerobicForReplication(m_pAnaerobicBurst, replPool, replCd);
+        if (!SCR_RSS_WPrimeServerTick.ReplicationChanged(m_fReplAnaerobicPool, replPool, m_fReplAnaerobicCooldownUntil, replCd))
+            return true;
+
         m_fReplAnaerobicPool = replPool;
         m_fReplAnaerobicCooldownUntil = replCd;
         Replication.BumpMe();
+        return true;
     }
 
     SCR_RSS_AnaerobicBurst RSS_GetAnaerobicBurst()
@@ -1733,14 +1985,20 @@ modded class SCR_CharacterControllerComponent
         m_bSprintGateEnginePokeActive = pokeActive;
     }
 
-    //! RSS-CPCR 推进 + 呼吸/心跳采样
+    //! RSS-CPCR 推进 + 呼吸/心跳采样（经表现时钟排程：未到期的帧只做一次比较）
     protected void RSS_UpdatePresentationSoundDrivers()
     {
+        if (!m_pPresentationClock)
+            return;
+
         float worldTimeSec = 0.0;
         if (GetGame() && GetGame().GetWorld())
             worldTimeSec = GetGame().GetWorld().GetWorldTime() / 1000.0;
 
-        if (m_pCardioDrive)
+        if (!m_pPresentationClock.IsDue(worldTimeSec))
+            return;
+
+        if (m_pCardioDrive && m_pPresentationClock.ConsumeSample(worldTimeSec))
         {
             RSS_RefreshCardioDriveSampleLive();
             m_pCardioDrive.Tick(worldTimeSec);
@@ -1754,13 +2012,23 @@ modded class SCR_CharacterControllerComponent
             respiratory01 = m_pCardioDrive.GetRespiratory01();
         }
 
+        float heartbeatNextSec = -1.0;
+        float breathNextSec = -1.0;
         if (m_pHeartbeatSoundDriver)
+        {
             m_pHeartbeatSoundDriver.Update(worldTimeSec, cardiac01);
+            heartbeatNextSec = m_pHeartbeatSoundDriver.GetNextEventSec();
+        }
         if (m_pBreathSoundDriver)
+        {
             m_pBreathSoundDriver.Update(worldTimeSec, respiratory01);
+            breathNextSec = m_pBreathSoundDriver.GetNextEventSec();
+        }
+
+        m_pPresentationClock.Schedule(breathNextSec, heartbeatNextSec);
     }
 
-    //! PrepareControls 间补采样，使冲刺起停时心/肺轴更跟手
+    //! 表现时钟采样节拍上补采样，使冲刺起停时心/肺轴更跟手
     protected void RSS_RefreshCardioDriveSampleLive()
     {
         if (!m_pCardioDrive)
@@ -1855,6 +2123,15 @@ modded class SCR_CharacterControllerComponent
 
     protected int GetSpeedUpdateIntervalMs()
     {
+        // 服务器 AI：LOD 档由登记表批量刷新，不再逐次遍历玩家。
+        // 玩家释放控制后主循环不重启，未登记时在此补登记。
+        if (SCR_RSS_AIConstants.RSS_PERF_AI_DISTANCE_LOD_ENABLED
+            && Replication.IsServer() && !IsPlayerControlled() && GetGame() && GetGame().GetWorld())
+        {
+            RSS_AcquireAiRegistrySlot();
+            int lodTier = SCR_RSS_AiLodRegistry.Get().GetLodTier(m_iRssAiSlot, GetGame().GetWorld().GetWorldTime());
+            return SCR_RSS_AIUpdateInterval.IntervalForLodTier(lodTier);
+        }
         return SCR_RSS_AIUpdateInterval.GetSpeedUpdateIntervalMs(IsPlayerControlled(), GetOwner());
     }
 
@@ -1890,6 +2167,38 @@ modded class SCR_CharacterControllerComponent
         return SCR_CombatStimStateMachine.IsOverdosed(m_iCombatStimPhase);
     }
 
+    //! tick 内的限速写入（AI 速度档等）：暂存到本 tick 的输出，未在 tick 中时直接写
+    void RSS_StageSpeedLimit(float limit)
+    {
+        if (m_pSpeedOutputStage)
+        {
+            m_pSpeedOutputStage.StageLimit(limit);
+            return;
+        }
+        SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(GetOwner(), limit);
+    }
+
+    //! 新增流血效果时由 SCR_BleedingDamageEffect.OnEffectAdded 通知（仅 Buff 期间需要重设）
+    void RSS_CombatStim_OnBleedingEffectAdded()
+    {
+        if (SCR_CombatStimStateMachine.IsActive(m_iCombatStimPhase))
+            m_bRSS_CombatStimBleedingDirty = true;
+    }
+
+    protected void RSS_CombatStim_MaybeRefreshBleeding(float worldTimeSec)
+    {
+        if (!m_bRSS_CombatStimBleedingDirty && worldTimeSec < m_fRSS_CombatStimBleedingNextCheckAt)
+            return;
+
+        m_bRSS_CombatStimBleedingDirty = false;
+        m_fRSS_CombatStimBleedingNextCheckAt = worldTimeSec + SCR_RSS_CombatStimController.BLEEDING_RESCALE_SAFETY_SEC;
+        if (!m_pCachedOwnerCharacter)
+            return;
+        SCR_CharacterDamageManagerComponent stimDmgMgr = SCR_CharacterDamageManagerComponent.Cast(m_pCachedOwnerCharacter.GetDamageManager());
+        if (stimDmgMgr)
+            SCR_RSS_CombatStimController.RefreshBleedingEffectsToMatchScale(stimDmgMgr);
+    }
+
     protected void RSS_CombatStim_OnTickTransitions()
     {
         float wt = GetGame().GetWorld().GetWorldTime() / 1000.0;
@@ -1922,6 +2231,7 @@ modded class SCR_CharacterControllerComponent
             SCR_RSS_CombatStimController.UpdateBleedingScale(
                 m_iCombatStimPhase, m_fRSS_CombatStimBleedingBaseline, ch,
                 m_fRSS_CombatStimBleedingBaseline);
+        m_fRSS_CombatStimBleedingNextCheckAt = wt + SCR_RSS_CombatStimController.BLEEDING_RESCALE_SAFETY_SEC;
     }
 
     void RSS_CombatStim_OnInjectServer()
@@ -1969,6 +2279,7 @@ modded class SCR_CharacterControllerComponent
         SCR_RSS_CombatStimController.UpdateBleedingScale(
             m_iCombatStimPhase, m_fRSS_CombatStimBleedingBaseline, ch,
             m_fRSS_CombatStimBleedingBaseline);
+        m_fRSS_CombatStimBleedingNextCheckAt = wt + SCR_RSS_CombatStimController.BLEEDING_RESCALE_SAFETY_SEC;
     }
 
     [RplRpc(RplChannel.Reliable, RplRcver.Owner)]
@@ -1989,6 +2300,7 @@ modded class SCR_CharacterControllerComponent
             return;
 
         float currentTime = GetGame().GetWorld().GetWorldTime() / 1000.0;
+        RSS_EnsureNetworkSyncManager();
 
         bool shouldIgnore = false;
         float clampedStamina = SCR_PlayerBaseRpcHandler.ProcessClientReport_ValidateStamina(
@@ -2002,14 +2314,15 @@ modded class SCR_CharacterControllerComponent
         if (m_pEncumbranceCache && m_pEncumbranceCache.IsCacheValid())
             encPenalty = m_pEncumbranceCache.GetSpeedPenaltyFraction();
 
-        IEntity ownerEnt = GetOwner();
-        bool shouldSuppressSlopeServer = (m_pEnvironmentFactor && ownerEnt && m_pEnvironmentFactor.ShouldSuppressTerrainSlopeForEntity(ownerEnt));
+        SCR_RSS_SlopeSample slopeSample = new SCR_RSS_SlopeSample();
+        SCR_RSS_SpeedCalculator.SampleSlope(this, m_pEnvironmentFactor, slopeSample);
+        bool shouldSuppressSlopeServer = slopeSample.m_bSuppressed;
 
+        float rawSlopeServer = SCR_RSS_SpeedCalculator.GetRawSlopeAngleFromSample(slopeSample, GetVelocity());
         float slopeAngleDegrees = 0.0;
         if (!shouldSuppressSlopeServer)
-            slopeAngleDegrees = SCR_RSS_SpeedCalculator.GetSlopeAngle(this, m_pEnvironmentFactor, GetVelocity());
+            slopeAngleDegrees = rawSlopeServer;
 
-        float rawSlopeServer = SCR_RSS_SpeedCalculator.GetRawSlopeAngle(this, GetVelocity());
         if (shouldSuppressSlopeServer && Math.AbsFloat(rawSlopeServer) > 0.0)
             encPenalty = encPenalty * SCR_RSS_Constants.GetIndoorStairsEncumbranceSpeedFactor();
 
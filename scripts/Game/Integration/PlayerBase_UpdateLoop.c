@@ -60,6 +60,7 @@ class RSS_StaminaDebugOutputParams
     float wPrimePool01;
     float landPositionDeltaSpeedMs;
     float overspeedExtraDrainPerSec;
+    StaminaTickRates rates;
 }
 
 //! Cross-phase scratch for stamina tick (ICE split of UpdateSpeedBasedOnStamina)
@@ -102,6 +103,7 @@ class RSS_StaminaTickLocals
     float speedRatio;
     vector velocityForDrain;
     float slopeAngleDegrees;
+    ref SCR_RSS_SlopeSample slopeSample;
     ref GradeCalculationResult gradeResult;
     float gradePercent;
     bool isSprinting;
@@ -182,37 +184,24 @@ modded class SCR_CharacterControllerComponent
                 m_fLastStaminaUpdateTime, m_fCurrentWetWeight,
                 GetSpeedUpdateIntervalMs(), IsRssDebugEnabled()))
         {
+            // 乘员降频：约 1 Hz 解析推进；下车后下一次 tick 即回到常规循环
             m_bRssStaminaLoopActive = true;
-            GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.Tick, GetSpeedUpdateIntervalMs(), false, this);
+            // 下车位置与上车前无关：丢弃坡度平滑状态，下车首 tick 从原始坡度起步
+            if (m_pGradeEstimator)
+                m_pGradeEstimator.Reset();
+            int vehicleIntervalMs = Math.Max(GetSpeedUpdateIntervalMs(), SCR_RSS_VehicleRecovery.TICK_INTERVAL_MS);
+            GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.Tick, vehicleIntervalMs, false, this);
             return false;
         }
         
         loc.isPlayer = IsPlayerControlled();
 
         if (loc.isPlayer)
-        {
             RSS_CombatStim_OnTickTransitions();
 
-            if (Replication.IsServer() && SCR_CombatStimStateMachine.IsActive(m_iCombatStimPhase))
-            {
-                if (m_pCachedOwnerCharacter)
-                {
-                    SCR_CharacterDamageManagerComponent stimDmgMgr = SCR_CharacterDamageManagerComponent.Cast(m_pCachedOwnerCharacter.GetDamageManager());
-                    if (stimDmgMgr)
-                        SCR_RSS_CombatStimController.RefreshBleedingEffectsToMatchScale(stimDmgMgr);
-                }
-            }
-        }
-
-        if (!loc.isPlayer && Replication.IsServer() && SCR_CombatStimStateMachine.IsActive(m_iCombatStimPhase))
-        {
-            if (m_pCachedOwnerCharacter)
-            {
-                SCR_CharacterDamageManagerComponent stimDmgMgr = SCR_CharacterDamageManagerComponent.Cast(m_pCachedOwnerCharacter.GetDamageManager());
-                if (stimDmgMgr)
-                    SCR_RSS_CombatStimController.RefreshBleedingEffectsToMatchScale(stimDmgMgr);
-            }
-        }
+        // 流血倍率事件驱动：阶段切换与新增流血时重设，另有慢速安全计时；其余 tick 只做一次比较
+        if (Replication.IsServer() && SCR_CombatStimStateMachine.IsActive(m_iCombatStimPhase))
+            RSS_CombatStim_MaybeRefreshBleeding(loc.world.GetWorldTime() / 1000.0);
 
         loc.staminaPercent = GetRssAerobicPercent();
         loc.staminaPercent = Math.Clamp(loc.staminaPercent, 0.0, 1.0);
@@ -237,17 +226,17 @@ modded class SCR_CharacterControllerComponent
                 float limpAbs = compensatedLimpMultiplier * GetOriginalEngineMaxSpeed_Run();
                 float phaseTop = GetRssSpeedLimitEngineBaseMs();
                 float limpFrac = SCR_RSS_SpeedBridge.FractionForAbsoluteSpeed(limpAbs, phaseTop);
-                SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, limpFrac);
+                m_pSpeedOutputStage.StageLimit(limpFrac);
                 m_fLastRssSpeedMultiplierApplied = limpFrac;
                 float safeCap = SCR_RSS_SpeedBridge.GetPhaseSafePhysicsCapMs(
                     limpAbs, phaseTop, false, GetCurrentMovementPhase());
                 m_fAppliedSpeedLimitMs = safeCap;
                 if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
-                    SCR_RSS_SpeedBridge.ClampOwnerHorizontalSpeed(loc.owner, safeCap);
+                    m_pSpeedOutputStage.StageHardClamp(safeCap);
             }
             else
             {
-                SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, compensatedLimpMultiplier);
+                m_pSpeedOutputStage.StageLimit(compensatedLimpMultiplier);
             }
 
             if (!m_bLastExhaustedState && IsRssDebugEnabled())
@@ -269,7 +258,7 @@ modded class SCR_CharacterControllerComponent
         loc.isSwimmingForSpeed = SCR_RSS_SwimmingStateManager.IsSwimming(this);
         if (loc.isSwimmingForSpeed)
         {
-            float dtSeconds = GetSpeedUpdateIntervalMs() / 1000.0;
+            float dtSeconds = m_pTickScheduler.GetElapsedSec();
             SpeedCalculationResult speedResult = SCR_RSS_UpdateCoordinator.CalculateCurrentSpeed(
                 loc.owner, m_vLastPositionSample, m_bHasLastPositionSample, m_vComputedVelocity, dtSeconds);
             loc.velocity = speedResult.computedVelocity;
@@ -283,7 +272,7 @@ modded class SCR_CharacterControllerComponent
             loc.velocity = GetVelocity();
             loc.currentSpeed = SCR_PlayerBaseRssApiHelper.CalculateCurrentSpeed(loc.velocity);
 
-            float dtSeconds = GetSpeedUpdateIntervalMs() / 1000.0;
+            float dtSeconds = m_pTickScheduler.GetElapsedSec();
             SpeedCalculationResult posSpeedResult = SCR_RSS_UpdateCoordinator.CalculateCurrentSpeed(
                 loc.owner, m_vLastPositionSample, m_bHasLastPositionSample, m_vComputedVelocity, dtSeconds);
             m_vLastPositionSample = posSpeedResult.lastPositionSample;
@@ -316,6 +305,14 @@ modded class SCR_CharacterControllerComponent
         if (m_pEnvironmentFactor)
             m_pEnvironmentFactor.UpdateEnvironmentFactors(loc.currentTime, loc.owner, loc.velocity, loc.terrainFactor, m_fCurrentWetWeight);
 
+        // 坡度每 tick 只采样一次：限速、代谢与预测限速共用同一坡度 / 室内判定；
+        // 移动中走高度格估计器，法线只在静止或室内楼梯时查询
+        loc.slopeSample = new SCR_RSS_SlopeSample();
+        SCR_RSS_GradeEstimator gradeEstimator = null;
+        if (!loc.isSwimmingForSpeed && !IsClimbing())
+            gradeEstimator = RSS_GetGradeEstimator();
+        SCR_RSS_SpeedCalculator.SampleSlope(this, m_pEnvironmentFactor, loc.slopeSample, gradeEstimator, loc.velocity, loc.currentTime);
+
         loc.finalSpeedMultiplier = SCR_RSS_UpdateCoordinator.UpdateSpeed(
             this,
             loc.staminaPercent,
@@ -326,7 +323,8 @@ modded class SCR_CharacterControllerComponent
             m_pSlopeSpeedTransition,
             loc.velocity,
             loc.terrainFactor,
-            loc.effectivePhase);
+            loc.effectivePhase,
+            loc.slopeSample);
 
         loc.customSprintSpeedMult = SCR_RSS_ConfigBridge.GetCustomSprintSpeedMultiplier();
         if (loc.customSprintSpeedMult != 1.0)
@@ -409,7 +407,7 @@ modded class SCR_CharacterControllerComponent
         if (!SCR_RSS_SpeedBridge.IsStaminaSpeedPressEnabled())
         {
             // 试跑：清掉体力限速源，不硬钳；代谢用 v_meas（applied=-1）
-            SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, 1.0);
+            m_pSpeedOutputStage.StageLimit(1.0);
             RSS_RestoreNativeMovementMaxSpeed(loc.owner);
             m_fAppliedSpeedLimitMs = -1.0;
             m_fLastRssSpeedMultiplierApplied = 1.0;
@@ -443,7 +441,7 @@ modded class SCR_CharacterControllerComponent
                 if (desiredFrac >= 0.999)
                     desiredFrac = 0.999;
             }
-            SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, desiredFrac);
+            m_pSpeedOutputStage.StageLimit(desiredFrac);
             float slewedAbsMs = desiredFrac * loc.storedEngineBase;
             float safeCap = SCR_RSS_SpeedBridge.GetPhaseSafePhysicsCapMs(
                 slewedAbsMs,
@@ -459,7 +457,7 @@ modded class SCR_CharacterControllerComponent
             if (m_fLastRssSpeedMultiplierApplied < 0.01)
                 m_fLastRssSpeedMultiplierApplied = 0.01;
             if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
-                SCR_RSS_SpeedBridge.ClampOwnerHorizontalSpeed(loc.owner, safeCap);
+                m_pSpeedOutputStage.StageHardClamp(safeCap);
             if (SCR_RSS_SpeedBridge.IsMovementMaxSpeedTrialEnabled())
                 RSS_ApplyTrialMovementMaxSpeed(loc.owner, safeCap);
 
@@ -471,14 +469,14 @@ modded class SCR_CharacterControllerComponent
                     enforceCruisePhys = true;
                 if (enforceCruisePhys)
                 {
-                    float clampDt = GetSpeedUpdateIntervalMs() / 1000.0;
+                    float clampDt = m_pTickScheduler.GetElapsedSec();
                     if (clampDt < 0.01)
                         clampDt = 0.05;
                     int clampPhase = loc.phaseNow;
                     if (loc.effectivePhase == 1)
                         clampPhase = 1;
                     SCR_RSS_SpeedBridge.EnforceCpCruisePhysicsCap(
-                        loc.owner,
+                        m_pSpeedOutputStage,
                         safeCap,
                         loc.currentSpeed,
                         clampDt,
@@ -493,7 +491,7 @@ modded class SCR_CharacterControllerComponent
                 desiredAbsMs, loc.storedEngineBase, false);
             if (aiFrac > 1.0)
                 aiFrac = 1.0;
-            SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, aiFrac);
+            m_pSpeedOutputStage.StageLimit(aiFrac);
             m_fLastRssSpeedMultiplierApplied = aiFrac;
         }
         if (IsPlayerControlled())
@@ -536,7 +534,8 @@ modded class SCR_CharacterControllerComponent
             loc.timeDeltaSec = loc.currentTime - m_fLastStaminaUpdateTime;
         else
             loc.timeDeltaSec = GetSpeedUpdateIntervalMs() / 1000.0;
-        loc.timeDeltaSec = Math.Clamp(loc.timeDeltaSec, 0.01, 0.5);
+        // 真实步长：AI 远 LOD / 玩家降频的长步不再截断，仅挡卡顿/暂停
+        loc.timeDeltaSec = Math.Clamp(loc.timeDeltaSec, 0.01, SCR_RSS_TickScheduler.MAX_STEP_SEC);
 
         if (loc.isSwimming != m_bWasSwimming)
             m_bSwimmingVelocityDebugPrinted = false;
@@ -601,13 +600,11 @@ modded class SCR_CharacterControllerComponent
         if (loc.useSwimmingModel && !HasSwimInput())
             loc.velocityForDrain = vector.Zero;
 
-        loc.slopeAngleDegrees = 0.0;
-        loc.gradeResult = SCR_RSS_SpeedCalculator.CalculateGradePercent(
+        loc.gradeResult = SCR_RSS_SpeedCalculator.CalculateGradePercentFromSample(
             this,
             loc.currentSpeed,
             m_pJumpVaultDetector,
-            loc.slopeAngleDegrees,
-            m_pEnvironmentFactor,
+            loc.slopeSample,
             loc.velocityForDrain);
         loc.gradePercent = loc.gradeResult.gradePercent;
         loc.slopeAngleDegrees = loc.gradeResult.slopeAngleDegrees;
@@ -631,7 +628,8 @@ modded class SCR_CharacterControllerComponent
                     metabPhase = 2;
             }
 
-            float gradeForCap = RSS_SmoothGradePercentForSpeed(loc.gradePercent, loc.currentTime);
+            float gradeForCap = RSS_GradePercentForSpeedCap(
+                loc.gradePercent, loc.currentTime, loc.slopeSample, loc.currentSpeed);
             float correctedSpeed = SCR_RSS_DrainCalculator.GetMetabolicCorrectedSpeedMultiplier(
                 m_fLastRssSpeedMultiplierApplied,
                 loc.currentSpeed,
@@ -644,7 +642,8 @@ modded class SCR_CharacterControllerComponent
                 engineBase,
                 loc.currentTime,
                 cpModel,
-                m_fAppliedSpeedLimitMs);
+                m_fAppliedSpeedLimitMs,
+                m_pMetabolicTickContext);
             if (correctedSpeed != m_fLastRssSpeedMultiplierApplied
                 && SCR_RSS_SpeedBridge.IsStaminaSpeedPressEnabled())
             {
@@ -653,14 +652,14 @@ modded class SCR_CharacterControllerComponent
                     float hardFrac = RSS_SlewSpeedLimitFraction(correctedSpeed, loc.currentTime);
                     if (hardFrac > 0.999)
                         hardFrac = 0.999;
-                    SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, hardFrac);
+                    m_pSpeedOutputStage.StageLimit(hardFrac);
                     float hardAbs = hardFrac * engineBase;
                     float safeCap = SCR_RSS_SpeedBridge.GetPhaseSafePhysicsCapMs(
                         hardAbs, engineBase, loc.isSprintingNow, loc.phaseNow);
                     m_fAppliedSpeedLimitMs = safeCap;
                     m_fLastRssSpeedMultiplierApplied = hardFrac;
                     if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
-                        SCR_RSS_SpeedBridge.ClampOwnerHorizontalSpeed(loc.owner, safeCap);
+                        m_pSpeedOutputStage.StageHardClamp(safeCap);
                     if (SCR_RSS_Constants.V6_CP_CRUISE_OVERSPEED_PHYSICS_CLAMP)
                     {
                         bool metabDisarmed = false;
@@ -672,7 +671,7 @@ modded class SCR_CharacterControllerComponent
                         if (metabDisarmed || loc.phaseNow == 1)
                         {
                             SCR_RSS_SpeedBridge.EnforceCpCruisePhysicsCap(
-                                loc.owner,
+                                m_pSpeedOutputStage,
                                 safeCap,
                                 loc.currentSpeed,
                                 loc.timeDeltaSec,
@@ -683,7 +682,7 @@ modded class SCR_CharacterControllerComponent
                 }
                 else
                 {
-                    SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, correctedSpeed);
+                    m_pSpeedOutputStage.StageLimit(correctedSpeed);
                     m_fLastRssSpeedMultiplierApplied = correctedSpeed;
                     m_fAppliedSpeedLimitMs = correctedSpeed * engineBase;
                 }
@@ -710,7 +709,8 @@ modded class SCR_CharacterControllerComponent
                     loc.terrainFactor,
                     loc.effectivePhase,
                     pool01BeforeTick,
-                    loc.isSprintActive);
+                    loc.isSprintActive,
+                    m_pMetabolicTickContext);
 
                 if (cpModel)
                 {
@@ -761,12 +761,12 @@ modded class SCR_CharacterControllerComponent
                 }
 
                 m_pAnaerobicBurst.TickPower(powerW, loc.isSprintActive, loc.currentTime, loc.timeDeltaSec, loc.currentSpeed);
+                // TickPower 后冻结 CP / W′ 池 / 武装态：EPOC、超速帽与消耗读同一份
+                m_pMetabolicTickContext.CapturePostTick(cpModel);
                 if (m_pEpocState)
                 {
                     // EPOC：限速内意图功率；无 W′ 超速记账时再钳到 CP（与有氧 P_bill 对齐，避免下坡跑飞停步暴罚）
-                    float cpForEpoc = -1.0;
-                    if (cpModel)
-                        cpForEpoc = cpModel.GetEffectiveCriticalPowerWatts();
+                    float cpForEpoc = m_pMetabolicTickContext.GetCriticalPowerWatts();
                     m_pEpocState.SetEffectiveCpWatts(cpForEpoc);
                     float powerForEpoc = SCR_RSS_DrainCalculator.GetEpocSamplePowerWatts(
                         loc.currentSpeed,
@@ -775,12 +775,13 @@ modded class SCR_CharacterControllerComponent
                         loc.gradePercent,
                         loc.terrainFactor,
                         loc.phaseNow,
-                        cpForEpoc);
+                        cpForEpoc,
+                        m_pMetabolicTickContext);
                     bool overspeedNow = SCR_RSS_DrainCalculator.IsMetabolicOverspeedAccounting(
                         loc.currentSpeed, m_fAppliedSpeedLimitMs);
                     bool overspeedArmed = false;
                     if (cpModel)
-                        overspeedArmed = SCR_RSS_DrainCalculator.IsWPrimePoolAvailableForOverspeed(cpModel);
+                        overspeedArmed = m_pMetabolicTickContext.IsOverspeedArmed();
                     bool billAboveCp = false;
                     if (loc.isSprintActive)
                         billAboveCp = true;
@@ -827,7 +828,9 @@ modded class SCR_CharacterControllerComponent
             bool overspeeding = SCR_RSS_DrainCalculator.IsMetabolicOverspeedAccounting(
                 loc.currentSpeed, m_fAppliedSpeedLimitMs);
             bool wPrimeAllowsOverspeed = false;
-            if (cpPostTick)
+            if (m_pMetabolicTickContext.IsPostTickCaptured())
+                wPrimeAllowsOverspeed = m_pMetabolicTickContext.IsOverspeedArmed();
+            else if (cpPostTick)
                 wPrimeAllowsOverspeed = SCR_RSS_DrainCalculator.IsWPrimePoolAvailableForOverspeed(
                     cpPostTick);
             else
@@ -848,7 +851,8 @@ modded class SCR_CharacterControllerComponent
                         loc.totalWeightWithWetAndBody,
                         loc.gradePercent,
                         loc.terrainFactor,
-                        cpPostTick);
+                        cpPostTick,
+                        m_pMetabolicTickContext);
                     if (wPrimeCapNow > 0.05)
                         disarmTargetAbs = wPrimeCapNow;
                 }
@@ -880,7 +884,7 @@ modded class SCR_CharacterControllerComponent
                     if (!wPrimeAllowsOverspeed || loc.phaseNow == 1)
                     {
                         SCR_RSS_SpeedBridge.EnforceCpCruisePhysicsCap(
-                            loc.owner,
+                            m_pSpeedOutputStage,
                             safeCap,
                             loc.currentSpeed,
                             loc.timeDeltaSec,
@@ -928,7 +932,8 @@ modded class SCR_CharacterControllerComponent
                         loc.totalWeightWithWetAndBody,
                         loc.gradePercent,
                         loc.terrainFactor,
-                        cpPostTick);
+                        cpPostTick,
+                        m_pMetabolicTickContext);
                     if (wPrimeCapMs > 0.05)
                     {
                         if (hardAbs < 0.05 || wPrimeCapMs < hardAbs)
@@ -949,7 +954,7 @@ modded class SCR_CharacterControllerComponent
                     hardAbs, engineBase, keepSrc);
                 if (IsPlayerControlled())
                 {
-                    SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(loc.owner, hardFrac);
+                    m_pSpeedOutputStage.StageLimit(hardFrac);
                     float safeCap = SCR_RSS_SpeedBridge.GetPhaseSafePhysicsCapMs(
                         hardAbs, engineBase, loc.isSprintingNow, loc.phaseNow);
                     m_fAppliedSpeedLimitMs = safeCap;
@@ -958,7 +963,7 @@ modded class SCR_CharacterControllerComponent
                         if (!wPrimeAllowsOverspeed || loc.phaseNow == 1)
                         {
                             SCR_RSS_SpeedBridge.EnforceCpCruisePhysicsCap(
-                                loc.owner,
+                                m_pSpeedOutputStage,
                                 safeCap,
                                 loc.currentSpeed,
                                 loc.timeDeltaSec,
@@ -969,10 +974,10 @@ modded class SCR_CharacterControllerComponent
                 }
                 else
                 {
-                    SCR_RSS_SpeedBridge.ApplyHardStaminaSpeedClamp(loc.owner, hardFrac);
+                    m_pSpeedOutputStage.StageLimit(hardFrac);
                     m_fAppliedSpeedLimitMs = hardAbs;
                     if (SCR_RSS_SpeedBridge.IsHorizontalSpeedClampEnabled())
-                        SCR_RSS_SpeedBridge.ClampOwnerHorizontalSpeed(loc.owner, hardAbs);
+                        m_pSpeedOutputStage.StageHardClamp(hardAbs);
                 }
                 m_fLastRssSpeedMultiplierApplied = hardFrac;
                 loc.finalSpeedMultiplier = hardFrac;
@@ -985,7 +990,7 @@ modded class SCR_CharacterControllerComponent
                 if (m_fAppliedSpeedLimitMs > 0.05)
                 {
                     SCR_RSS_SpeedBridge.EnforceCpCruisePhysicsCap(
-                        loc.owner,
+                        m_pSpeedOutputStage,
                         m_fAppliedSpeedLimitMs,
                         loc.currentSpeed,
                         loc.timeDeltaSec,
@@ -1005,7 +1010,8 @@ modded class SCR_CharacterControllerComponent
                 loc.totalWeightWithWetAndBody,
                 loc.gradePercent,
                 loc.terrainFactor,
-                loc.phaseNow);
+                loc.phaseNow,
+                m_pMetabolicTickContext);
             float fatigueCpWatts = -1.0;
             if (m_pAnaerobicBurst)
             {
@@ -1031,6 +1037,9 @@ modded class SCR_CharacterControllerComponent
 
         if (SCR_RSS_ConfigBridge.IsMudSlipMechanismEnabled())
         {
+            // 首次启用泥泞滑倒时才创建
+            if (!m_pMudSlipRunner)
+                m_pMudSlipRunner = new SCR_RSS_MudSlipRunner();
             if (m_pMudSlipRunner)
             {
                 m_pMudSlipRunner.ProcessAfterSlope(
@@ -1055,8 +1064,10 @@ modded class SCR_CharacterControllerComponent
         {
             RSS_SetMudSlipCameraShake01(0.0);
         }
-        if (!loc.isPlayer && Replication.IsServer() && m_pAIManager)
+        if (!loc.isPlayer && Replication.IsServer())
         {
+            if (!m_pAIManager)
+                m_pAIManager = new SCR_RSS_AIManager();
             float fatigueVal;
             if (m_pFatigueSystem)
                 fatigueVal = m_pFatigueSystem.GetFatigueAccumulation();
@@ -1101,15 +1112,54 @@ modded class SCR_CharacterControllerComponent
             return;
         }
 
+        // 本 tick 的限速/速度钳只暂存，结束时（含早退）统一落盘一次
+        if (!m_pSpeedOutputStage)
+            m_pSpeedOutputStage = new SCR_RSS_SpeedOutputStage();
+        m_pSpeedOutputStage.Begin();
+        if (!m_pMetabolicTickContext)
+            m_pMetabolicTickContext = new SCR_RSS_MetabolicTickContext();
+        m_pMetabolicTickContext.Begin();
+        if (!m_pTickScheduler)
+            m_pTickScheduler = new SCR_RSS_TickScheduler();
+        float tickStartSec = 0.0;
+        if (GetGame().GetWorld())
+            tickStartSec = GetGame().GetWorld().GetWorldTime() / 1000.0;
+        m_pTickScheduler.BeginTick(tickStartSec, GetSpeedUpdateIntervalMs() / 1000.0);
+
+        m_iRssTickId++;
+
         RSS_StaminaTickLocals loc = new RSS_StaminaTickLocals();
-        if (!RSS_StaminaTickPhaseA(loc))
-            return;
-        if (!RSS_StaminaTickPhaseB(loc))
+        bool tickContinues = RSS_StaminaTickPhaseA(loc);
+        if (tickContinues)
+            tickContinues = RSS_StaminaTickPhaseB(loc);
+        if (tickContinues)
+            RSS_StaminaTickPhaseC(loc);
+        float commitTimeSec = 0.0;
+        if (GetGame().GetWorld())
+            commitTimeSec = GetGame().GetWorld().GetWorldTime() / 1000.0;
+        m_pSpeedOutputStage.Commit(owner, commitTimeSec);
+        if (!tickContinues)
             return;
-        RSS_StaminaTickPhaseC(loc);
+
+        RSS_EvaluateStateEvents(owner);
 
         m_bRssStaminaLoopActive = true;
-        GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.Tick, GetSpeedUpdateIntervalMs(), false, this);
+        int intervalMs = GetSpeedUpdateIntervalMs();
+        if (loc.isPlayer)
+        {
+            m_iRssTickStance = GetStance();
+            bool quiescent = loc.currentSpeed < SCR_RSS_TickScheduler.IDLE_SPEED_MS
+                && loc.phaseNow == 0
+                && !loc.sprintIntent
+                && !loc.isSwimming;
+            intervalMs = m_pTickScheduler.ResolveIntervalMs(intervalMs, quiescent, loc.phaseNow, m_iRssTickStance, commitTimeSec);
+            if (m_pTickScheduler.IsIdleRate())
+            {
+                GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.TickIdle, intervalMs, false, this, m_pTickScheduler.GetGeneration());
+                return;
+            }
+        }
+        GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.Tick, intervalMs, false, this);
     }
 
     void RSS_LoopStartSystem()
@@ -1122,6 +1172,7 @@ modded class SCR_CharacterControllerComponent
             return;
         if (!GetGame())
             return;
+        RSS_AcquireAiRegistrySlot();
         m_bRssStaminaLoopActive = true;
         int intervalMs = GetSpeedUpdateIntervalMs();
         GetGame().GetCallqueue().CallLater(SCR_PlayerBaseLoop.Tick, intervalMs, false, this);
@@ -59,10 +59,11 @@ class SCR_PlayerBaseDebugHelper
 
 class SCR_PlayerBaseInventoryHelper
 {
-    static void UpdateEncumbranceCache(SCR_RSS_EncumbranceCache encumbranceCache)
+    //! 库存事件增量记账；sign: +1 添加 / -1 移除
+    static void ApplyEncumbranceItemDelta(SCR_RSS_EncumbranceCache encumbranceCache, IEntity item, float sign)
     {
         if (encumbranceCache)
-            encumbranceCache.UpdateCache();
+            encumbranceCache.ApplyItemDelta(item, sign);
     }
 }
 
@@ -10,6 +10,14 @@ class SCR_PlayerBaseLoop
         ctrl.UpdateSpeedBasedOnStamina();
     }
 
+    //! 降频回调：Promote 已插队时代号过期，丢弃以免出现两条 tick 链
+    static void TickIdle(SCR_CharacterControllerComponent ctrl, int generation)
+    {
+        if (!ctrl || !ctrl.RSS_IsTickGenerationCurrent(generation))
+            return;
+        ctrl.UpdateSpeedBasedOnStamina();
+    }
+
     static void DelayedStart(SCR_CharacterControllerComponent ctrl)
     {
         if (!ctrl)
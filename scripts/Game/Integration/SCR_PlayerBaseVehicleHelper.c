@@ -5,7 +5,11 @@
 
 class SCR_PlayerBaseVehicleHelper
 {
+    //! 乘员恢复解析推进器（单线程调用，全体共用一份系数暂存）
+    protected static ref SCR_RSS_VehicleRecovery s_pRecovery;
+
     //! 在载具中时处理体力恢复（不消耗体力，仅恢复）
+    //! 调用频率约 1 Hz（SCR_RSS_VehicleRecovery.TICK_INTERVAL_MS），区间内按闭式解推进
     //! @return true 如果当前在载具中并已处理
     static bool HandleVehicleStaminaUpdate(
         SCR_CharacterControllerComponent ctrl,
@@ -30,7 +34,7 @@ class SCR_PlayerBaseVehicleHelper
 
         static int vehicleDebugCounter = 0;
         vehicleDebugCounter++;
-        if (vehicleDebugCounter >= 25)
+        if (vehicleDebugCounter >= 5)
         {
             vehicleDebugCounter = 0;
             if (staminaComponent && isDebugEnabled)
@@ -44,7 +48,7 @@ class SCR_PlayerBaseVehicleHelper
         if (exerciseTracker)
         {
             float vehicleCurrentTimeMs = GetGame().GetWorld().GetWorldTime();
-            exerciseTracker.Update(vehicleCurrentTimeMs, false, true);
+            exerciseTracker.Update(vehicleCurrentTimeMs, false, true, SCR_RSS_VehicleRecovery.MAX_INTERVAL_SEC);
         }
 
         float vehicleStaminaPercent = 1.0;
@@ -57,7 +61,6 @@ class SCR_PlayerBaseVehicleHelper
             vehicleNetRatePerSec = SCR_RSS_StaminaNetRate.GetNetStaminaRatePerSecond(
                 vehicleStaminaPercent, false, 0.0, -SCR_RSS_Constants.REST_RECOVERY_PER_TICK, 0.0, 0.0, 1.0,
                 epocState, encumbranceCache, exerciseTracker, ctrl, null, true);
-            float vehicleRecoveryRate = vehicleNetRatePerSec / 5.0;
 
             float currentWorldTime = GetGame().GetWorld().GetWorldTime() / 1000.0;
             if (fatigueSystem && SCR_RSS_ConfigBridge.IsFatigueSystemEnabled())
@@ -70,10 +73,10 @@ class SCR_PlayerBaseVehicleHelper
                 timeDeltaSec = currentWorldTime - lastStaminaUpdateTime;
             else
                 timeDeltaSec = speedUpdateIntervalMs / 1000.0;
-            timeDeltaSec = Math.Clamp(timeDeltaSec, 0.01, 0.5);
-            float tickScale = Math.Clamp(timeDeltaSec / 0.2, 0.01, 2.0);
+            timeDeltaSec = Math.Clamp(timeDeltaSec, 0.01, SCR_RSS_VehicleRecovery.MAX_INTERVAL_SEC);
             float oldStamina = vehicleStaminaPercent;
-            float newStamina = Math.Clamp(oldStamina + vehicleRecoveryRate * tickScale, 0.0, maxStaminaCap);
+            float newStamina = AdvanceRecovery(
+                oldStamina, timeDeltaSec, maxStaminaCap, vehicleNetRatePerSec, exerciseTracker, isDebugEnabled);
             if (vehicleStaminaPercent > maxStaminaCap)
                 newStamina = maxStaminaCap;
             staminaComponent.SetTargetStamina(newStamina);
@@ -125,4 +128,39 @@ class SCR_PlayerBaseVehicleHelper
         ctrl.RSS_SetMudSlipCameraShake01(0.0);
         return true;
     }
+
+    //------------------------------------------------------------------------------------------------
+    //! 闭式推进 intervalSec 秒；解析率与逐 tick 路径的净恢复率（netRatePerSec）不一致时退回单步欧拉
+    protected static float AdvanceRecovery(
+        float staminaPercent,
+        float intervalSec,
+        float staminaCap,
+        float netRatePerSec,
+        SCR_RSS_ExerciseTracker exerciseTracker,
+        bool isDebugEnabled)
+    {
+        float restMinutes = 0.0;
+        float exerciseMinutes = 0.0;
+        if (exerciseTracker)
+        {
+            restMinutes = exerciseTracker.GetRestDurationMinutes();
+            exerciseMinutes = exerciseTracker.GetExerciseDurationMinutes();
+        }
+
+        if (!s_pRecovery)
+            s_pRecovery = new SCR_RSS_VehicleRecovery();
+        s_pRecovery.Prepare(restMinutes, exerciseMinutes);
+
+        float modelRatePerSec = s_pRecovery.RatePerSecond(staminaPercent);
+        float parityGap = Math.AbsFloat(modelRatePerSec - netRatePerSec);
+        if (parityGap > SCR_RSS_VehicleRecovery.PARITY_REL_TOL * Math.AbsFloat(netRatePerSec) + 0.0000001)
+        {
+            if (isDebugEnabled)
+                PrintFormat("[RSS] 载具解析恢复对照失配 / Vehicle recovery parity mismatch: model=%1/s net=%2/s -> Euler",
+                    modelRatePerSec.ToString(), netRatePerSec.ToString());
+            return Math.Clamp(staminaPercent + netRatePerSec * intervalSec, 0.0, staminaCap);
+        }
+
+        return Math.Clamp(s_pRecovery.Advance(staminaPercent, intervalSec, staminaCap), 0.0, staminaCap);
+    }
 }
@@ -0,0 +1,20 @@
+// 流血效果扩展
+// 战斗 Stim Buff 期间新增的流血需按当前倍率重设 DPS；在此通知角色控制器，不再逐 tick 扫描流血效果
+modded class SCR_BleedingDamageEffect
+{
+    override void OnEffectAdded(SCR_ExtendedDamageManagerComponent dmgManager)
+    {
+        super.OnEffectAdded(dmgManager);
+
+        if (!dmgManager || !Replication.IsServer())
+            return;
+
+        IEntity owner = dmgManager.GetOwner();
+        if (!owner)
+            return;
+
+        SCR_CharacterControllerComponent characterController = SCR_CharacterControllerComponent.Cast(owner.FindComponent(SCR_CharacterControllerComponent));
+        if (characterController)
+            characterController.RSS_CombatStim_OnBleedingEffectAdded();
+    }
+}
@@ -1,5 +1,5 @@
 // 库存管理器组件扩展
-// 负责监听物品移除事件，立即更新负重缓存
+// 负责监听物品增减事件，把物品总重作为有符号增量计入负重缓存（不再全量扫描；嵌套事件由缓存按实体层级去重）
 modded class SCR_InventoryStorageManagerComponent : ScriptedInventoryStorageManagerComponent
 {
     // 当物品从库存中移除时调用
@@ -17,7 +17,7 @@ modded class SCR_InventoryStorageManagerComponent : ScriptedInventoryStorageMana
         if (characterController)
         {
             // 通知角色控制器组件更新负重缓存
-            characterController.OnItemRemovedFromInventory();
+            characterController.OnItemRemovedFromInventory(item);
         }
     }
     
@@ -36,7 +36,7 @@ modded class SCR_InventoryStorageManagerComponent : ScriptedInventoryStorageMana
         if (characterController)
         {
             // 通知角色控制器组件更新负重缓存
-            characterController.OnItemAddedToInventory();
+            characterController.OnItemAddedToInventory(item);
         }
     }
 }
\ No newline at end of file
@@ -269,6 +269,7 @@ modded class SCR_BaseGameMode
         // 与 SCR_RSS_Settings 旧版同步路径一致：客户端记录“服务器是否开启导出”，供 GetServerDataExportEnabled / 体力上报使用。
         SCR_RSS_ConfigManager.SetServerDataExportEnabled(m_bRssDataExport);
 
+        SCR_RSS_ConfigManager.NotifySettingsChanged();
         SCR_RSS_ConfigManager.SetServerConfigApplied(true);
         SCR_RSS_StaminaHUDComponent.SyncHintDisplayWithSettings();
     }
@@ -4,31 +4,39 @@
 //!   感知（SetPerceptionFactor） / 射速（SetFireRateCoef） / 技能（SetAISkill）
 //!
 //! 全部通过 SCR_AICombatComponent 公开 API，需在威胁系统初始化后调用。
+//! 引擎侧 setter 并不便宜：仅在状态跳变时写入，组件句柄由 SCR_RSS_AIComponentCache 提供。
 
 class SCR_RSS_AICombatDecay
 {
     //------------------------------------------------------------------------------------------------
-    //! 主入口
-    static void Apply(IEntity owner, ERSS_AIStaminaState state)
+    //! 主入口（由 SCR_RSS_AIManager 仅在状态跳变 / 安全刷新时调用）
+    //! \param comps  AI 组件句柄缓存
+    //! \param state  当前体力状态
+    //! \return       false = 威胁系统未就绪、感知未写入，调用方下个行为 tick 重试
+    static bool Apply(SCR_RSS_AIComponentCache comps, ERSS_AIStaminaState state)
     {
         if (!SCR_RSS_ConfigBridge.IsAIStaminaCombatEffectsEnabled())
-            return;
-        if (!owner)
-            return;
+            return true;
+        if (!comps)
+            return true;
         if (!Replication.IsServer())
-            return;
+            return true;
 
-        SCR_AICombatComponent combat = SCR_AICombatComponent.Cast(owner.FindComponent(SCR_AICombatComponent));
+        SCR_AICombatComponent combat = comps.GetCombat();
         if (!combat)
-            return;
+            return true;
 
         // 根据状态取衰减系数
         float perceptionMul, fireRateMul, skillMul;
         GetDecayParams(state, perceptionMul, fireRateMul, skillMul);
 
         // 感知
-        if (IsAIThreatSystemReady(owner))
+        bool perceptionApplied = false;
+        if (comps.IsThreatSystemReady())
+        {
             combat.SetPerceptionFactor(perceptionMul);
+            perceptionApplied = true;
+        }
 
         // 射速
         combat.SetFireRateCoef(fireRateMul, false);
@@ -48,7 +56,7 @@ class SCR_RSS_AICombatDecay
         if (diffPerception < 0.001 && diffFireRate < 0.001)
         {
             combat.ResetAISkill();
-            return;
+            return perceptionApplied;
         }
 
         int blendedInt = Math.Round(vRef * skillMul);
@@ -56,6 +64,7 @@ class SCR_RSS_AICombatDecay
             blendedInt = 0;
         EAISkill sk = ValueToNearestAISkill(blendedInt);
         combat.SetAISkill(sk);
+        return perceptionApplied;
     }
 
     //------------------------------------------------------------------------------------------------
@@ -111,21 +120,6 @@ class SCR_RSS_AICombatDecay
         }
     }
 
-    //------------------------------------------------------------------------------------------------
-    protected static bool IsAIThreatSystemReady(IEntity owner)
-    {
-        AIControlComponent aiControl = AIControlComponent.Cast(owner.FindComponent(AIControlComponent));
-        if (!aiControl)
-            return false;
-        AIAgent agent = aiControl.GetAIAgent();
-        if (!agent)
-            return false;
-        SCR_AIInfoComponent info = SCR_AIInfoComponent.Cast(agent.FindComponent(SCR_AIInfoComponent));
-        if (!info)
-            return false;
-        return info.GetThreatSystem() != null;
-    }
-
     //------------------------------------------------------------------------------------------------
     protected static int AISkillToValue(EAISkill skill)
     {
@@ -0,0 +1,140 @@
+//! RSS AI Component Cache — AI 组件句柄缓存
+//!
+//! 每个 SCR_RSS_AIManager 持有一份，避免行为层每 500ms 重复 FindComponent。
+//! 实体侧组件（控制器 / 战斗 / 移动 / 设置）在 owner 生命周期内不变，首次访问时解析一次；
+//! AIAgent 侧组件（Utility / Info）可能晚于实体就绪，未解析到时下次访问再试。
+
+class SCR_RSS_AIComponentCache
+{
+    protected IEntity m_pOwner;
+    protected bool m_bEntityComponentsResolved;
+
+    protected SCR_CharacterControllerComponent m_pController;
+    protected SCR_AICombatComponent m_pCombat;
+    protected AICharacterMovementComponent m_pAiMovement;
+    protected SCR_AICharacterSettingsComponent m_pAiSettings;
+
+    protected SCR_AIUtilityComponent m_pUtility;
+    protected SCR_AIInfoComponent m_pAiInfo;
+
+    //------------------------------------------------------------------------------------------------
+    //! 绑定实体；owner 变化时清空全部句柄
+    void Bind(IEntity owner)
+    {
+        if (owner == m_pOwner)
+            return;
+        Clear();
+        m_pOwner = owner;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void Clear()
+    {
+        m_pOwner = null;
+        m_bEntityComponentsResolved = false;
+        m_pController = null;
+        m_pCombat = null;
+        m_pAiMovement = null;
+        m_pAiSettings = null;
+        m_pUtility = null;
+        m_pAiInfo = null;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    IEntity GetOwner()
+    {
+        return m_pOwner;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    SCR_CharacterControllerComponent GetController()
+    {
+        ResolveEntityComponents();
+        return m_pController;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    SCR_AICombatComponent GetCombat()
+    {
+        ResolveEntityComponents();
+        return m_pCombat;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    AICharacterMovementComponent GetAiMovement()
+    {
+        ResolveEntityComponents();
+        return m_pAiMovement;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    SCR_AICharacterSettingsComponent GetAiSettings()
+    {
+        ResolveEntityComponents();
+        return m_pAiSettings;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! Utility 可能挂在实体或 AIAgent 上；未就绪返回 null，下次再解析
+    SCR_AIUtilityComponent GetUtility()
+    {
+        if (m_pUtility)
+            return m_pUtility;
+        if (!m_pOwner)
+            return null;
+
+        m_pUtility = SCR_AIUtilityComponent.Cast(m_pOwner.FindComponent(SCR_AIUtilityComponent));
+        if (m_pUtility)
+            return m_pUtility;
+
+        AIAgent agent = ResolveAgent();
+        if (agent)
+            m_pUtility = SCR_AIUtilityComponent.Cast(agent.FindComponent(SCR_AIUtilityComponent));
+        return m_pUtility;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 威胁系统就绪后 SetPerceptionFactor 才生效
+    bool IsThreatSystemReady()
+    {
+        if (!m_pAiInfo)
+        {
+            AIAgent agent = ResolveAgent();
+            if (!agent)
+                return false;
+            m_pAiInfo = SCR_AIInfoComponent.Cast(agent.FindComponent(SCR_AIInfoComponent));
+            if (!m_pAiInfo)
+                return false;
+        }
+        return m_pAiInfo.GetThreatSystem() != null;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void ResolveEntityComponents()
+    {
+        if (m_bEntityComponentsResolved)
+            return;
+        if (!m_pOwner)
+            return;
+        m_bEntityComponentsResolved = true;
+
+        m_pController = SCR_CharacterControllerComponent.Cast(
+            m_pOwner.FindComponent(SCR_CharacterControllerComponent));
+        m_pCombat = SCR_AICombatComponent.Cast(m_pOwner.FindComponent(SCR_AICombatComponent));
+        m_pAiMovement = AICharacterMovementComponent.Cast(
+            m_pOwner.FindComponent(AICharacterMovementComponent));
+        m_pAiSettings = SCR_AICharacterSettingsComponent.Cast(
+            m_pOwner.FindComponent(SCR_AICharacterSettingsComponent));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected AIAgent ResolveAgent()
+    {
+        if (!m_pOwner)
+            return null;
+        AIControlComponent aiControl = AIControlComponent.Cast(m_pOwner.FindComponent(AIControlComponent));
+        if (!aiControl)
+            return null;
+        return aiControl.GetAIAgent();
+    }
+}
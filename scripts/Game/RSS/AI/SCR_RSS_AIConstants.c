@@ -59,4 +59,8 @@ class SCR_RSS_AIConstants
 
     // [SOFT] AI 行为过滤 — 常量
     static const float RSS_AI_INTENT_WAIT_PROMOTED_PRIORITY = 100.0;
+
+    // [SOFT] AI 行为层落盘节流 — 仅状态跳变 / 连续倍率越过滞回步长时写引擎 AI setter
+    static const float RSS_AI_APPLY_SPEED_MUL_STEP = 0.05;       // RECOVERING 连续限速倍率滞回步长
+    static const float RSS_AI_APPLY_REFRESH_SEC = 5.0;           // 安全重申（载具上下车 / 配置开关 / 行为树覆写）
 }
@@ -6,16 +6,19 @@
 class SCR_RSS_AIIntentFilter
 {
     //------------------------------------------------------------------------------------------------
-    static void Apply(IEntity owner, ERSS_AIStaminaState state, ERSS_AIStaminaState prevState, bool isThreatened)
+    //! \param comps      AI 组件句柄缓存（Utility 由其解析并缓存）
+    //! \param state      当前体力状态
+    //! \param prevState  上次已落盘的体力状态（决定是否还原战斗行为）
+    static void Apply(SCR_RSS_AIComponentCache comps, ERSS_AIStaminaState state, ERSS_AIStaminaState prevState, bool isThreatened)
     {
         if (!SCR_RSS_ConfigBridge.IsAIIntentFilterEnabled())
             return;
-        if (!owner)
+        if (!comps)
             return;
         if (!Replication.IsServer())
             return;
 
-        SCR_AIUtilityComponent utility = ResolveUtility(owner);
+        SCR_AIUtilityComponent utility = comps.GetUtility();
         if (!utility)
             return;
 
@@ -105,28 +108,6 @@ class SCR_RSS_AIIntentFilter
         }
     }
 
-    //------------------------------------------------------------------------------------------------
-    protected static SCR_AIUtilityComponent ResolveUtility(IEntity owner)
-    {
-        if (!owner)
-            return null;
-
-        SCR_AIUtilityComponent aiUtil = SCR_AIUtilityComponent.Cast(
-            owner.FindComponent(SCR_AIUtilityComponent));
-        if (aiUtil)
-            return aiUtil;
-
-        AIControlComponent aiControl = AIControlComponent.Cast(
-            owner.FindComponent(AIControlComponent));
-        if (!aiControl)
-            return null;
-        AIAgent agent = aiControl.GetAIAgent();
-        if (!agent)
-            return null;
-        return SCR_AIUtilityComponent.Cast(
-            agent.FindComponent(SCR_AIUtilityComponent));
-    }
-
     //------------------------------------------------------------------------------------------------
     //! 禁用行为：COMPLETED 使 CustomEvaluate / 选型跳过该类型（含 SCR_AIAttackBehavior）。
     protected static void BlockActionType(SCR_AIUtilityComponent utility, typename actionType)
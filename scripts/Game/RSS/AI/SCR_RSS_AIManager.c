@@ -6,6 +6,10 @@
 //! 职责范围：
 //!   - 行为层节流（500ms）
 //!   - 体力状态机 Tick + SpeedCap / IntentFilter / CombatDecay 模块链
+//!   - 模块链仅在状态跳变、RECOVERING 连续限速越过滞回步长或安全刷新到期时落盘
+//!     （引擎 AI setter 不便宜，数百 AI 时每 500ms 重复写入是纯开销）
+//!   - 限速倍率缓存后每 tick 暂存进速度输出（Phase A 每 tick 都会暂存自己的倍率，只在落盘时写会被覆盖）；
+//!     上载具 / 下水时立即撤销缓存倍率，离开后下一个行为 tick 重新落盘
 
 // ============================================================================
 // Tick 返回结果
@@ -30,6 +34,20 @@ class SCR_RSS_AIManager
     protected float m_fTimeStationarySec;
     protected float m_fLastDebugPrintTime;
 
+    // ── 组件句柄缓存 ──
+    protected ref SCR_RSS_AIComponentCache m_pComponents;
+
+    // ── 已落盘状态（跳变检测） ──
+    protected bool m_bHasAppliedState;
+    protected ERSS_AIStaminaState m_eAppliedState;
+    protected float m_fAppliedSpeedMul;
+    //! SpeedCap 最近一次落盘求得的限速倍率（-1 = 不限速）；每 tick 暂存
+    protected float m_fStagedSpeedCap;
+    //! 缓存倍率因载具/游泳被撤销，恢复时需强制落盘
+    protected bool m_bSpeedCapSuspended;
+    protected float m_fLastApplyTime;
+    protected bool m_bCombatDecayPending;
+
     // ========================================================================
     //  构造
     // ========================================================================
@@ -39,6 +57,8 @@ class SCR_RSS_AIManager
         m_fTimeStationarySec = 0.0;
         m_fLastDebugPrintTime = -1.0;
         m_fLastBehaviorTickTime = -1.0;
+        m_pComponents = new SCR_RSS_AIComponentCache();
+        ResetAppliedState();
     }
 
     // ========================================================================
@@ -52,6 +72,24 @@ class SCR_RSS_AIManager
         float fatigueVal,
         float currentSpeed,
         bool isPlayer)
+    {
+        ERSS_AIManagerTickResult result = TickBehavior(
+            owner, currentTime, timeDeltaSec, staminaPercent, fatigueVal, currentSpeed, isPlayer);
+        StageCachedSpeedCap();
+        return result;
+    }
+
+    // ========================================================================
+    //  行为层：节流 + 状态机 + 模块链落盘判定
+    // ========================================================================
+    protected ERSS_AIManagerTickResult TickBehavior(
+        IEntity owner,
+        float currentTime,
+        float timeDeltaSec,
+        float staminaPercent,
+        float fatigueVal,
+        float currentSpeed,
+        bool isPlayer)
     {
         if (!owner)
             return ERSS_AIManagerTickResult.AI_TICK_NORMAL;
@@ -81,18 +119,89 @@ class SCR_RSS_AIManager
             m_fTimeStationarySec,
             m_eStaminaState);
 
+        // ── 跳变检测：状态未变且连续倍率未越过滞回步长时不触碰引擎 ──
+        float speedMul = SCR_RSS_AISpeedCap.ResolveSpeedMultiplier(aiState, staminaPercent);
+        if (!ShouldApply(aiState, speedMul, currentTime))
+            return ERSS_AIManagerTickResult.AI_TICK_NORMAL;
+
+        ERSS_AIStaminaState appliedPrev = prevState;
+        if (m_bHasAppliedState)
+            appliedPrev = m_eAppliedState;
+
         // ── 模块链按序 Apply ──
         bool isThreatened = false;  // 群组功能已移除，默认非威胁状态
-        SCR_CharacterControllerComponent ctrl = SCR_CharacterControllerComponent.Cast(
-            owner.FindComponent(SCR_CharacterControllerComponent));
-        if (ctrl)
+        m_pComponents.Bind(owner);
+        m_fStagedSpeedCap = SCR_RSS_AISpeedCap.Apply(m_pComponents, aiState, staminaPercent, isThreatened);
+        SCR_RSS_AIIntentFilter.Apply(m_pComponents, aiState, appliedPrev, isThreatened);
+        bool combatApplied = SCR_RSS_AICombatDecay.Apply(m_pComponents, aiState);
+
+        m_bHasAppliedState = true;
+        m_eAppliedState = aiState;
+        m_fAppliedSpeedMul = speedMul;
+        m_fLastApplyTime = currentTime;
+        m_bCombatDecayPending = !combatApplied;
+
+        return ERSS_AIManagerTickResult.AI_TICK_NORMAL;
+    }
+
+    // ========================================================================
+    //  落盘判定：是否需要把模块链写入引擎
+    // ========================================================================
+    protected bool ShouldApply(ERSS_AIStaminaState aiState, float speedMul, float currentTime)
+    {
+        if (!m_bHasAppliedState)
+            return true;
+        if (aiState != m_eAppliedState)
+            return true;
+        if (Math.AbsFloat(speedMul - m_fAppliedSpeedMul) >= SCR_RSS_AIConstants.RSS_AI_APPLY_SPEED_MUL_STEP)
+            return true;
+        // 威胁系统晚于实体就绪：感知未写入时每个行为 tick 重试
+        if (m_bCombatDecayPending)
+            return true;
+        if (m_fLastApplyTime < 0.0 || currentTime - m_fLastApplyTime >= SCR_RSS_AIConstants.RSS_AI_APPLY_REFRESH_SEC)
+            return true;
+        return false;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 每 tick：把缓存的限速倍率暂存进本 tick 的速度输出（不触碰 AI setter）
+    protected void StageCachedSpeedCap()
+    {
+        if (!m_bHasAppliedState)
+            return;
+        if (m_fStagedSpeedCap < 0.0 && !m_bSpeedCapSuspended)
+            return;
+        SCR_CharacterControllerComponent ctrl = m_pComponents.GetController();
+        if (!ctrl || ctrl.IsPlayerControlled())
+            return;
+
+        bool suspended = SCR_RSS_AISpeedCap.IsSuspended(m_pComponents.GetOwner(), ctrl);
+        if (suspended)
+        {
+            m_fStagedSpeedCap = -1.0;
+            m_bSpeedCapSuspended = true;
+            return;
+        }
+        if (m_bSpeedCapSuspended)
         {
-            SCR_RSS_AISpeedCap.Apply(ctrl, owner, aiState, staminaPercent, isThreatened);
+            // 下车 / 出水：让下一个行为 tick 重新求倍率并落盘
+            m_bSpeedCapSuspended = false;
+            m_fLastApplyTime = -1.0;
+            m_fLastBehaviorTickTime = -1.0;
+            return;
         }
-        SCR_RSS_AIIntentFilter.Apply(owner, aiState, prevState, isThreatened);
-        SCR_RSS_AICombatDecay.Apply(owner, aiState);
+        ctrl.RSS_StageSpeedLimit(m_fStagedSpeedCap);
+    }
 
-        return ERSS_AIManagerTickResult.AI_TICK_NORMAL;
+    protected void ResetAppliedState()
+    {
+        m_bHasAppliedState = false;
+        m_eAppliedState = ERSS_AIStaminaState.FRESH;
+        m_fAppliedSpeedMul = 1.0;
+        m_fStagedSpeedCap = -1.0;
+        m_bSpeedCapSuspended = false;
+        m_fLastApplyTime = -1.0;
+        m_bCombatDecayPending = false;
     }
 
     // ========================================================================
@@ -121,5 +230,8 @@ class SCR_RSS_AIManager
     void OnEntityDeleted()
     {
         m_fLastBehaviorTickTime = -1.0;
+        if (m_pComponents)
+            m_pComponents.Clear();
+        ResetAppliedState();
     }
 }
@@ -3,51 +3,62 @@
 //! 根据体力状态决定 AI 的最高移动类型和速度上限（经 SetSpeedLimit 与灌木减速合并）。
 //! 同时包含连续速度衰减曲线（与玩家同源 STAMINA_EXPONENT = 0.6）。
 //!
-//! 调用方：PlayerBase.c 每帧 Tick
+//! 调用方：SCR_RSS_AIManager 行为层（仅状态跳变 / 连续倍率越过滞回步长时写移动类型并求限速倍率；
+//! 倍率由 AIManager 缓存，每 tick 暂存进速度输出，避免被同 tick 的 Phase A 覆盖）
 //! 不侵入原生行为树节点——通过 SetMovementTypeWanted + SetSpeedLimit（经 SCR_RSS_SpeedBridge）间接控制。
 
 class SCR_RSS_AISpeedCap
 {
+    //------------------------------------------------------------------------------------------------
+    //! 载具中或游泳时不限速（AIManager 每 tick 暂存缓存倍率前也用它判断是否该撤销）
+    static bool IsSuspended(IEntity owner, SCR_CharacterControllerComponent ctrl)
+    {
+        ChimeraCharacter ch = ChimeraCharacter.Cast(owner);
+        if (ch)
+        {
+            CompartmentAccessComponent compAccess = ch.GetCompartmentAccessComponent();
+            if (compAccess && compAccess.GetCompartment())
+                return true;
+        }
+        return ctrl && SCR_RSS_SwimmingStateManager.IsSwimming(ctrl);
+    }
+
     //------------------------------------------------------------------------------------------------
     //! 主入口：对 AI 实体施加基于体力状态的移动限制。
     //!
-    //! \param ctrl            角色控制器
-    //! \param owner           实体（IEntity）
+    //! \param comps           AI 组件句柄缓存（控制器 / 移动 / 设置）
     //! \param state           当前体力状态
     //! \param staminaPercent  体力百分比 [0~1]
     //! \param isThreatened    当前是否被压制 (THREATENED)
-    static void Apply(
-        SCR_CharacterControllerComponent ctrl,
-        IEntity owner,
+    //! \return 需要每 tick 暂存的限速倍率；-1 = 不限速（不覆盖 Phase A）
+    static float Apply(
+        SCR_RSS_AIComponentCache comps,
         ERSS_AIStaminaState state,
         float staminaPercent,
         bool isThreatened)
     {
+        if (!comps)
+            return -1.0;
+        IEntity owner = comps.GetOwner();
+        SCR_CharacterControllerComponent ctrl = comps.GetController();
         if (!ctrl || !owner)
-            return;
+            return -1.0;
 
         // 玩家不使用此模块
         if (ctrl.IsPlayerControlled())
-            return;
+            return -1.0;
 
         // 仅服务器端
         if (!Replication.IsServer())
-            return;
+            return -1.0;
 
         // 载具中 / 游泳 → 不限速
-        ChimeraCharacter ch = ChimeraCharacter.Cast(owner);
-        if (ch)
-        {
-            CompartmentAccessComponent compAccess = ch.GetCompartmentAccessComponent();
-            if (compAccess && compAccess.GetCompartment())
-                return;
-        }
-        if (SCR_RSS_SwimmingStateManager.IsSwimming(ctrl))
-            return;
+        if (IsSuspended(owner, ctrl))
+            return -1.0;
 
         // 被压制时不限速（保命优先）
         if (isThreatened)
-            return;
+            return -1.0;
 
         float speedMul;
         EMovementType maxMovement;
@@ -56,14 +67,14 @@ class SCR_RSS_AISpeedCap
         {
         case ERSS_AIStaminaState.FRESH:
             // 全速，不干预
-            return;
+            return -1.0;
 
         case ERSS_AIStaminaState.WINDED:
             // 禁止 Sprint，其余正常
             maxMovement = EMovementType.RUN;
             speedMul = 1.0;
-            AISetMovementTypeWanted(owner, maxMovement);
-            return;  // 不高 OverrideMaxSpeed
+            AISetMovementTypeWanted(comps, maxMovement);
+            return -1.0;  // 不高 OverrideMaxSpeed
 
         case ERSS_AIStaminaState.FATIGUED:
             // RUN + 限速到 65%
@@ -90,11 +101,30 @@ class SCR_RSS_AISpeedCap
             break;
 
         default:
-            return;
+            return -1.0;
         }
 
-        AISetMovementTypeWanted(owner, maxMovement);
-        SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(owner, speedMul);
+        AISetMovementTypeWanted(comps, maxMovement);
+        return speedMul;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 该状态下 Apply 将返回的限速倍率（不触碰引擎），供 AIManager 做滞回比较。
+    //! \return 1.0 = 不限速（FRESH / WINDED）
+    static float ResolveSpeedMultiplier(ERSS_AIStaminaState state, float staminaPercent)
+    {
+        switch (state)
+        {
+        case ERSS_AIStaminaState.FATIGUED:
+            return SCR_RSS_AIConstants.RSS_AI_SPEED_FATIGUED_LIMIT;
+        case ERSS_AIStaminaState.EXHAUSTED:
+            return SCR_RSS_AIConstants.RSS_AI_SPEED_EXHAUSTED_LIMIT;
+        case ERSS_AIStaminaState.COLLAPSED:
+            return 0.01;
+        case ERSS_AIStaminaState.RECOVERING:
+            return GetRecoveringSpeedMultiplier(staminaPercent);
+        }
+        return 1.0;
     }
 
     //------------------------------------------------------------------------------------------------
@@ -115,19 +145,17 @@ class SCR_RSS_AISpeedCap
 
     //------------------------------------------------------------------------------------------------
     //! 设置 AI 的想要的移动类型（经 AI 设置组件裁剪）
-    protected static void AISetMovementTypeWanted(IEntity owner, EMovementType speed)
+    protected static void AISetMovementTypeWanted(SCR_RSS_AIComponentCache comps, EMovementType speed)
     {
-        if (!owner)
+        if (!comps)
             return;
 
-        AICharacterMovementComponent aiMove = AICharacterMovementComponent.Cast(
-            owner.FindComponent(AICharacterMovementComponent));
+        AICharacterMovementComponent aiMove = comps.GetAiMovement();
         if (!aiMove)
             return;
 
         EMovementType resolved = speed;
-        SCR_AICharacterSettingsComponent settingsComp = SCR_AICharacterSettingsComponent.Cast(
-            owner.FindComponent(SCR_AICharacterSettingsComponent));
+        SCR_AICharacterSettingsComponent settingsComp = comps.GetAiSettings();
         if (settingsComp)
         {
             SCR_AICharacterMovementSpeedSettingBase setting = SCR_AICharacterMovementSpeedSettingBase.Cast(
@@ -52,6 +52,16 @@ class SCR_RSS_AIUpdateInterval
         return SCR_RSS_AIConstants.RSS_PERF_AI_LOD_FAR_INTERVAL_MS;
     }
 
+    //! 登记表 LOD 档 → 间隔（与上面按距离分档一致）
+    static int IntervalForLodTier(int lodTier)
+    {
+        if (lodTier == SCR_RSS_AiLodRegistry.LOD_FAR)
+            return SCR_RSS_AIConstants.RSS_PERF_AI_LOD_FAR_INTERVAL_MS;
+        if (lodTier == SCR_RSS_AiLodRegistry.LOD_MID)
+            return SCR_RSS_AIConstants.RSS_PERF_AI_LOD_MID_INTERVAL_MS;
+        return SCR_RSS_AIConstants.RSS_PERF_AI_LOD_NEAR_INTERVAL_MS;
+    }
+
     static bool IsWorkbenchPreviewEntity(bool isPlayerControlled, IEntity owner)
     {
 #ifdef WORKBENCH
@@ -0,0 +1,167 @@
+//! RSS AI LOD Registry — 服务器 AI 的稠密槽位登记（距离 LOD 批量刷新）
+//!
+//! 每个服务器端 AI 占一个稠密槽位，记录控制器、实体与距离 LOD 档。槽位在实体删除或被玩家接管时
+//! swap-remove，被移动的控制器通过 RSS_SetAiRegistrySlot 得知新槽位；玩家释放控制后由控制器重新登记。
+//!
+//! 距离 LOD 每 LOD_REFRESH_MS 一次：取一次玩家坐标后对全部槽位线性求最近距离，
+//! 取代每个 AI 每次取间隔都遍历全部玩家（O(AI×玩家)/tick）。
+//! 体力模型状态（CP/W′、疲劳、EPOC）只由各控制器持有，不在此镜像。
+//! 世界切换时整体重建。
+
+class SCR_RSS_AiLodRegistry
+{
+    static const int LOD_NEAR = 0;
+    static const int LOD_MID = 1;
+    static const int LOD_FAR = 2;
+    //! LOD 档刷新周期（ms）；近档 AI 200 ms 一 tick，档位变化秒级即可
+    static const float LOD_REFRESH_MS = 500.0;
+
+    protected static ref SCR_RSS_AiLodRegistry s_pInstance;
+
+    protected World m_pWorld;
+    protected float m_fLodRefreshedAtMs = -1.0;
+
+    protected ref array<SCR_CharacterControllerComponent> m_aController;
+    protected ref array<IEntity> m_aOwner;
+    protected ref array<int> m_aLodTier;
+
+    protected ref array<vector> m_aPlayerPosScratch;
+    protected ref array<int> m_aPlayerIdScratch;
+
+    //------------------------------------------------------------------------------------------------
+    void SCR_RSS_AiLodRegistry()
+    {
+        m_aController = new array<SCR_CharacterControllerComponent>();
+        m_aOwner = new array<IEntity>();
+        m_aLodTier = new array<int>();
+        m_aPlayerPosScratch = new array<vector>();
+        m_aPlayerIdScratch = new array<int>();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 当前世界的登记表；世界切换（换图/重开）时丢弃旧表
+    static SCR_RSS_AiLodRegistry Get()
+    {
+        World world = null;
+        if (GetGame())
+            world = GetGame().GetWorld();
+        if (!s_pInstance || s_pInstance.m_pWorld != world)
+        {
+            s_pInstance = new SCR_RSS_AiLodRegistry();
+            s_pInstance.m_pWorld = world;
+        }
+        return s_pInstance;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 分配槽位（新槽位 LOD 为近档，下一次刷新前按近档间隔运行）
+    int Acquire(SCR_CharacterControllerComponent ctrl, IEntity owner)
+    {
+        m_aController.Insert(ctrl);
+        m_aOwner.Insert(owner);
+        m_aLodTier.Insert(LOD_NEAR);
+        return m_aController.Count() - 1;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! swap-remove：末槽搬入 slot，并告知被搬动的控制器
+    void Release(int slot, SCR_CharacterControllerComponent ctrl)
+    {
+        if (slot < 0 || slot >= m_aController.Count() || m_aController[slot] != ctrl)
+            return;
+        RemoveSlot(slot);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 距离 LOD 档；到期时先对全部槽位线性刷新一次（刷新后按控制器当前槽位读取）
+    int GetLodTier(int slot, float nowMs)
+    {
+        SCR_CharacterControllerComponent ctrl = null;
+        if (slot >= 0 && slot < m_aController.Count())
+            ctrl = m_aController[slot];
+        if (m_fLodRefreshedAtMs < 0.0 || nowMs - m_fLodRefreshedAtMs >= LOD_REFRESH_MS || nowMs < m_fLodRefreshedAtMs)
+        {
+            RefreshLodTiers(nowMs);
+            // 刷新会回收死槽并 swap-remove，调用方可能已被搬到别的槽位
+            if (ctrl)
+                slot = ctrl.RSS_GetAiRegistrySlot();
+        }
+        if (slot < 0 || slot >= m_aLodTier.Count() || m_aController[slot] != ctrl)
+            return LOD_NEAR;
+        return m_aLodTier[slot];
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 一次取玩家坐标，线性遍历全部槽位求最近玩家距离；顺带回收已销毁实体的槽位
+    protected void RefreshLodTiers(float nowMs)
+    {
+        m_fLodRefreshedAtMs = nowMs;
+
+        m_aPlayerPosScratch.Clear();
+        PlayerManager pm = null;
+        if (GetGame())
+            pm = GetGame().GetPlayerManager();
+        if (pm)
+        {
+            pm.GetPlayers(m_aPlayerIdScratch);
+            foreach (int playerId : m_aPlayerIdScratch)
+            {
+                IEntity pe = pm.GetPlayerControlledEntity(playerId);
+                if (pe)
+                    m_aPlayerPosScratch.Insert(pe.GetOrigin());
+            }
+        }
+
+        float nearSq = SCR_RSS_AIConstants.RSS_PERF_AI_LOD_NEAR_M * SCR_RSS_AIConstants.RSS_PERF_AI_LOD_NEAR_M;
+        float farSq = SCR_RSS_AIConstants.RSS_PERF_AI_LOD_FAR_M * SCR_RSS_AIConstants.RSS_PERF_AI_LOD_FAR_M;
+        int playerCount = m_aPlayerPosScratch.Count();
+
+        int i = 0;
+        while (i < m_aController.Count())
+        {
+            IEntity owner = m_aOwner[i];
+            if (!m_aController[i] || !owner)
+            {
+                RemoveSlot(i);
+                continue;
+            }
+
+            // 无玩家时与逐实体版本一致：按近档
+            int tier = LOD_NEAR;
+            if (playerCount > 0)
+            {
+                vector pos = owner.GetOrigin();
+                float bestSq = vector.DistanceSq(pos, m_aPlayerPosScratch[0]);
+                for (int p = 1; p < playerCount; p++)
+                {
+                    float dSq = vector.DistanceSq(pos, m_aPlayerPosScratch[p]);
+                    if (dSq < bestSq)
+                        bestSq = dSq;
+                }
+                if (bestSq > farSq)
+                    tier = LOD_FAR;
+                else if (bestSq > nearSq)
+                    tier = LOD_MID;
+            }
+            m_aLodTier[i] = tier;
+            i++;
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void RemoveSlot(int slot)
+    {
+        int last = m_aController.Count() - 1;
+        if (slot != last)
+        {
+            m_aController[slot] = m_aController[last];
+            m_aOwner[slot] = m_aOwner[last];
+            m_aLodTier[slot] = m_aLodTier[last];
+            if (m_aController[slot])
+                m_aController[slot].RSS_SetAiRegistrySlot(slot);
+        }
+        m_aController.Remove(last);
+        m_aOwner.Remove(last);
+        m_aLodTier.Remove(last);
+    }
+}
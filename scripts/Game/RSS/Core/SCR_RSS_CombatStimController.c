@@ -3,6 +3,9 @@
 
 class SCR_RSS_CombatStimController
 {
+    //! Buff 期间流血 DPS 的兜底重设间隔（秒）：命中区血量变化会改变基础流血率，阶段切换/新增流血之外靠它跟上
+    static const float BLEEDING_RESCALE_SAFETY_SEC = 5.0;
+
     static float ComputeBleedingBaseRateForEffect(SCR_BleedingDamageEffect bleed)
     {
         if (!bleed)
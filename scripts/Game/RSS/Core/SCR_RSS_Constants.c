@@ -742,8 +742,7 @@ class SCR_RSS_Constants
     static const float V6_CARDIO_HEART_AUDIBLE = 0.22;
     //! 0.32：需明显抬升才出声。0.06 时呼吸轴刚离开静息就会播 regenerate 喘气采样
     static const float V6_CARDIO_BREATH_AUDIBLE = 0.32;
-    //! 表现音量（PlaySound + SoundManager.SetVolume）；心跳整体压低
-    static const float V6_PRESENTATION_VOL_SMOOTH = 0.14;
+    //! 表现音量（PlaySound + SoundManager.SetVolume，起播时取定）；心跳整体压低
     static const float V6_BREATH_VOL_MIN = 0.14;
     static const float V6_BREATH_VOL_MAX = 0.95;
     static const float V6_HEARTBEAT_VOL_MIN = 0.10;
@@ -1,10 +1,13 @@
 //! v6 CP–W′ 临界功率模型（Morin–Petit + Skiba 再填充）
 //! W′ 以焦耳存储；UI 仍可用 0–1 归一化
+//! 有效 CP 记忆化：负重/坡度/环境/疲劳乘数变化超过 CP_*_EPSILON 或配置纪元变化才重算，其余查询为字段读取
 
 class SCR_RSS_CriticalPowerModel
 {
     protected float m_fWPrimeJoules;
     protected float m_fWPrimeMaxJoules;
+    //! W′ 上限所依据的配置纪元（SCR_RSS_ConfigManager.GetConfigEpoch）
+    protected int m_iConfigEpoch = -1;
     //! 网络兼容字段；v6 不上时间 CD，恒为 -1
     protected float m_fCooldownUntilSec;
     protected float m_fFatigueCpMultiplier;
@@ -16,6 +19,16 @@ class SCR_RSS_CriticalPowerModel
     protected float m_fContextEnvCpMult;
     protected float m_fContextFatigueNorm;
 
+    //! 记忆化输入死区：小于此变化不置脏（CP 误差 < 0.1 W 量级）
+    static const float CP_LOAD_EPSILON_KG = 0.05;
+    static const float CP_GRADE_EPSILON_PCT = 0.05;
+    static const float CP_MULT_EPSILON = 0.0005;
+
+    protected bool m_bCpDirty = true;
+    protected int m_iCpConfigEpoch = -1;
+    protected float m_fCpBaseWatts;
+    protected float m_fCpEffectiveWatts;
+
     void SCR_RSS_CriticalPowerModel()
     {
         ResetToFull();
@@ -29,6 +42,7 @@ class SCR_RSS_CriticalPowerModel
     void ResetToFull()
     {
         m_fWPrimeMaxJoules = SCR_RSS_ConfigBridge.GetWPrimeMaxJoules();
+        m_iConfigEpoch = SCR_RSS_ConfigManager.GetConfigEpoch();
         m_fWPrimeJoules = m_fWPrimeMaxJoules;
         m_fCooldownUntilSec = -1.0;
         m_bOverspeedArmed = true;
@@ -62,17 +76,37 @@ class SCR_RSS_CriticalPowerModel
         return m_bOverspeedArmed;
     }
 
+    //! 疲劳度只影响 W′ 回充，始终写入；CP 输入超过死区才更新并置脏
     void SetRuntimeContext(float loadKg, float gradePercent, float envCpMult, float fatigueNorm)
     {
-        m_fContextLoadKg = Math.Max(loadKg, 0.0);
-        m_fContextGradePercent = gradePercent;
-        m_fContextEnvCpMult = Math.Clamp(envCpMult, SCR_RSS_Constants.V6_CP_ENV_FLOOR, 1.0);
         m_fContextFatigueNorm = Math.Clamp(fatigueNorm, 0.0, 1.0);
+
+        float load = Math.Max(loadKg, 0.0);
+        if (Math.AbsFloat(load - m_fContextLoadKg) > CP_LOAD_EPSILON_KG)
+        {
+            m_fContextLoadKg = load;
+            m_bCpDirty = true;
+        }
+        if (Math.AbsFloat(gradePercent - m_fContextGradePercent) > CP_GRADE_EPSILON_PCT)
+        {
+            m_fContextGradePercent = gradePercent;
+            m_bCpDirty = true;
+        }
+        float env = Math.Clamp(envCpMult, SCR_RSS_Constants.V6_CP_ENV_FLOOR, 1.0);
+        if (Math.AbsFloat(env - m_fContextEnvCpMult) > CP_MULT_EPSILON)
+        {
+            m_fContextEnvCpMult = env;
+            m_bCpDirty = true;
+        }
     }
 
     void SetFatigueCpMultiplier(float mult)
     {
-        m_fFatigueCpMultiplier = Math.Clamp(mult, 0.75, 1.0);
+        float clamped = Math.Clamp(mult, 0.75, 1.0);
+        if (Math.AbsFloat(clamped - m_fFatigueCpMultiplier) <= CP_MULT_EPSILON)
+            return;
+        m_fFatigueCpMultiplier = clamped;
+        m_bCpDirty = true;
     }
 
     float GetWPrimeJoules()
@@ -100,6 +134,30 @@ class SCR_RSS_CriticalPowerModel
 
     //! 动态 CP：load / slope / env（疲劳经 GetEffectiveCriticalPowerWatts × m_fFatigueCpMultiplier）
     float ComputeCpBaseWatts()
+    {
+        RefreshCpIfDirty();
+        return m_fCpBaseWatts;
+    }
+
+    float GetEffectiveCriticalPowerWatts()
+    {
+        RefreshCpIfDirty();
+        return m_fCpEffectiveWatts;
+    }
+
+    //! 输入置脏或配置纪元变化（CP0 随预设/参数改变）时重算
+    protected void RefreshCpIfDirty()
+    {
+        int epoch = SCR_RSS_ConfigManager.GetConfigEpoch();
+        if (!m_bCpDirty && epoch == m_iCpConfigEpoch)
+            return;
+        m_bCpDirty = false;
+        m_iCpConfigEpoch = epoch;
+        m_fCpBaseWatts = EvaluateCpBaseWatts();
+        m_fCpEffectiveWatts = m_fCpBaseWatts * m_fFatigueCpMultiplier;
+    }
+
+    protected float EvaluateCpBaseWatts()
     {
         float cp0 = SCR_RSS_ConfigBridge.GetCriticalPowerWatts();
         if (cp0 <= 1.0)
@@ -126,11 +184,6 @@ class SCR_RSS_CriticalPowerModel
         return cpLoad;
     }
 
-    float GetEffectiveCriticalPowerWatts()
-    {
-        return ComputeCpBaseWatts() * m_fFatigueCpMultiplier;
-    }
-
     protected bool UsesSkibaRecovery()
     {
         // 按档位显式分派（不再用 CP 阈值近似）：Elite=Skiba，Standard/Tactical=线性
@@ -199,6 +252,22 @@ class SCR_RSS_CriticalPowerModel
             m_fWPrimeJoules = m_fWPrimeMaxJoules;
     }
 
+    //! 配置纪元变化（管理员改预设/参数）：按新上限重取 W′，保持池百分比不变
+    protected void SyncConfigEpoch()
+    {
+        int epoch = SCR_RSS_ConfigManager.GetConfigEpoch();
+        if (epoch == m_iConfigEpoch)
+            return;
+        m_iConfigEpoch = epoch;
+
+        float newMax = SCR_RSS_ConfigBridge.GetWPrimeMaxJoules();
+        if (newMax <= 1.0 || newMax == m_fWPrimeMaxJoules)
+            return;
+        float pool = GetPool01();
+        m_fWPrimeMaxJoules = newMax;
+        m_fWPrimeJoules = pool * m_fWPrimeMaxJoules;
+    }
+
     void ApplyReplication(float pool01, float cooldownUntilSec, float wPrimeMaxJoules)
     {
         if (wPrimeMaxJoules > 1.0)
@@ -263,6 +332,7 @@ class SCR_RSS_CriticalPowerModel
 
     void Tick(float powerWatts, bool sprintIntent, float worldTimeSec, float timeDeltaSec, float currentSpeedMs = 0.0)
     {
+        SyncConfigEpoch();
         float cp = GetEffectiveCriticalPowerWatts();
 
         // Morin–Petit：P > CP 消耗 W′；静止且非 Sprint 意图时不扣无氧池
@@ -23,6 +23,21 @@ class SCR_RSS_DrainCalculator
         return GetDrainVelocityMs(measuredSpeedMs, appliedSpeedLimitMs);
     }
 
+    //! 代谢功率求值：有 tick 上下文时走其记忆（同 tick 同入参只算一次），否则直接求值
+    static float EvalPowerWatts(
+        SCR_RSS_MetabolicTickContext ctx,
+        float speedMs,
+        float totalWeightKg,
+        float gradePercent,
+        float terrainFactor,
+        int movementPhase)
+    {
+        if (ctx)
+            return ctx.PowerWatts(speedMs, totalWeightKg, gradePercent, terrainFactor, movementPhase);
+        return SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+            speedMs, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+    }
+
     //! 代谢记账功率（W）：按实测速度；有氧侧仍可 min(P, CP)
     static float GetMetabolicAccountingPowerWatts(
         float measuredSpeedMs,
@@ -32,12 +47,12 @@ class SCR_RSS_DrainCalculator
         float terrainFactor,
         int movementPhase,
         float wPrimePool01 = 1.0,
-        bool isSprinting = false)
+        bool isSprinting = false,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         float vAcct = GetMetabolicAccountingVelocityMs(
             measuredSpeedMs, appliedSpeedLimitMs, wPrimePool01, isSprinting);
-        return SCR_RSS_MetabolismModel.MetabolismPowerWatts(
-            vAcct, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        return EvalPowerWatts(ctx, vAcct, totalWeightKg, gradePercent, terrainFactor, movementPhase);
     }
 
     //! 疲劳积分功率（W）：与 EPOC 相同，用限速内意图速度。
@@ -48,11 +63,11 @@ class SCR_RSS_DrainCalculator
         float totalWeightKg,
         float gradePercent,
         float terrainFactor,
-        int movementPhase)
+        int movementPhase,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         float vFat = GetEpocSampleVelocityMs(measuredSpeedMs, appliedSpeedLimitMs);
-        return SCR_RSS_MetabolismModel.MetabolismPowerWatts(
-            vFat, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        return EvalPowerWatts(ctx, vFat, totalWeightKg, gradePercent, terrainFactor, movementPhase);
     }
 
     //! EPOC 峰值采样速度：限速内意图速度（硬钳关时 v_meas 可远超 v_limit，不能按跑飞速度记氧债）
@@ -77,11 +92,11 @@ class SCR_RSS_DrainCalculator
         float gradePercent,
         float terrainFactor,
         int movementPhase,
-        float criticalPowerWatts = -1.0)
+        float criticalPowerWatts = -1.0,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         float vEpoc = GetEpocSampleVelocityMs(measuredSpeedMs, appliedSpeedLimitMs);
-        float powerW = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
-            vEpoc, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        float powerW = EvalPowerWatts(ctx, vEpoc, totalWeightKg, gradePercent, terrainFactor, movementPhase);
         if (criticalPowerWatts > 1.0)
         {
             float storeCap = criticalPowerWatts
@@ -117,6 +132,7 @@ class SCR_RSS_DrainCalculator
     }
 
     //! W′ 耗尽且仍超速：返回应强制应用的绝对速度上限（m/s）；否则 -1
+    //! @param ctx 本 tick 代谢上下文：武装态取其 TickPower 后快照，门控后的巡航帽同 tick 只解一次
     static float GetWPrimeExhaustedOverspeedCapMs(
         float measuredSpeedMs,
         float appliedSpeedLimitMs,
@@ -125,17 +141,46 @@ class SCR_RSS_DrainCalculator
         float totalWeightKg,
         float gradePercent,
         float terrainFactor,
-        SCR_RSS_CriticalPowerModel cpModel)
+        SCR_RSS_CriticalPowerModel cpModel,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         if (!SCR_RSS_SpeedBridge.IsCpMetabolicSpeedCapEnabled())
             return -1.0;
         if (!IsMetabolicOverspeedAccounting(measuredSpeedMs, appliedSpeedLimitMs))
             return -1.0;
-        if (IsWPrimePoolAvailableForOverspeed(cpModel))
-            return -1.0;
         if (!cpModel)
             return -1.0;
+        if (ctx && ctx.IsPostTickCaptured())
+        {
+            if (ctx.IsOverspeedArmed())
+                return -1.0;
+        }
+        else if (IsWPrimePoolAvailableForOverspeed(cpModel))
+        {
+            return -1.0;
+        }
+
+        float memoCapMs;
+        if (ctx && ctx.TryGetWPrimeCapMs(memoCapMs))
+            return memoCapMs;
 
+        float capMs = ResolveWPrimeExhaustedCapMs(
+            measuredSpeedMs, movementPhase, totalWeightKg, gradePercent, terrainFactor, cpModel, ctx);
+        if (ctx)
+            ctx.StoreWPrimeCapMs(capMs);
+        return capMs;
+    }
+
+    //! W′ 耗尽巡航帽本体（门控之后）：CP 反解 + Run 巡航帽
+    protected static float ResolveWPrimeExhaustedCapMs(
+        float measuredSpeedMs,
+        int movementPhase,
+        float totalWeightKg,
+        float gradePercent,
+        float terrainFactor,
+        SCR_RSS_CriticalPowerModel cpModel,
+        SCR_RSS_MetabolicTickContext ctx)
+    {
         float capMs = GetMetabolicSpeedCapMs(
             measuredSpeedMs,
             movementPhase,
@@ -144,7 +189,9 @@ class SCR_RSS_DrainCalculator
             terrainFactor,
             false,
             0.0,
-            cpModel);
+            cpModel,
+            -1.0,
+            ctx);
         if (capMs <= 0.05)
         {
             float cp = cpModel.GetEffectiveCriticalPowerWatts();
@@ -155,9 +202,7 @@ class SCR_RSS_DrainCalculator
         }
 
         // Walk 不套有氧巡航硬顶；平路/上坡 Run 在 W′ 耗尽时不得超过 2.4；下坡不套平路帽
-        float cpWatts = -1.0;
-        if (cpModel)
-            cpWatts = cpModel.GetEffectiveCriticalPowerWatts();
+        float cpWatts = cpModel.GetEffectiveCriticalPowerWatts();
         capMs = ResolveRunCruiseCapMs(
             capMs, movementPhase, gradePercent, totalWeightKg, terrainFactor, cpWatts);
         if (capMs > 0.05)
@@ -270,7 +315,8 @@ class SCR_RSS_DrainCalculator
         bool isExhausted,
         float worldTimeSec,
         SCR_RSS_CriticalPowerModel cpModel,
-        float speedForPowerEvalMs = -1.0)
+        float speedForPowerEvalMs = -1.0,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         if (!SCR_RSS_SpeedBridge.IsCpMetabolicSpeedCapEnabled())
             return -1.0;
@@ -287,8 +333,7 @@ class SCR_RSS_DrainCalculator
         if (speedForPowerEvalMs >= 0.0)
             evalSpeed = speedForPowerEvalMs;
 
-        float powerW = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
-            evalSpeed, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        float powerW = EvalPowerWatts(ctx, evalSpeed, totalWeightKg, gradePercent, terrainFactor, movementPhase);
 
         bool isSprintPhase = false;
         if (movementPhase == 3)
@@ -362,7 +407,8 @@ class SCR_RSS_DrainCalculator
         float engineBaseMs,
         float worldTimeSec,
         SCR_RSS_CriticalPowerModel cpModel,
-        float appliedSpeedLimitMs = -1.0)
+        float appliedSpeedLimitMs = -1.0,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         if (engineBaseMs <= 0.05)
             engineBaseMs = SCR_RSS_MetabolismMath.GAME_MAX_SPEED;
@@ -381,7 +427,8 @@ class SCR_RSS_DrainCalculator
             isExhausted,
             worldTimeSec,
             cpModel,
-            speedForEval);
+            speedForEval,
+            ctx);
         if (capMs < 0.0)
             return appliedSpeedMultiplier;
 
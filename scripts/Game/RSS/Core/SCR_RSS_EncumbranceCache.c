@@ -1,10 +1,15 @@
 // 负重缓存管理模块
 // 负责管理负重的缓存计算和更新（事件驱动，性能优化）
 // 模块化拆分：从 PlayerBase.c 提取的独立功能模块
-
+//
+// 增量记账：库存 OnItemAdded/OnItemRemoved 带入物品总重（含附件与嵌套容器内容）作为有符号增量，不再全量扫描存储。
+// 管理器是否为嵌套内容另发事件未经确认，故同一 tick 内按实体层级去重：祖先已按同号计入的物品跳过，
+// 后到的祖先扣回已计入的同号子物品。速度惩罚多项式仅在重量或配置纪元（SCR_RSS_ConfigManager.GetConfigEpoch）变化时重算。
+// 低频校验（ENCUMBRANCE_VERIFY_INTERVAL）用 GetTotalWeightOfAllStorages 对账，纠正无事件的漂移
+// （弹药消耗、跨 tick 的嵌套事件等）。
 class SCR_RSS_EncumbranceCache
 {
-    // 与 UpdateCache 内分段多项式一致，供服务器 RPC 等在缓存无效时复用
+    // 缓存派生值与服务器 RPC 等缓存无效时的回退共用此分段多项式
     static float ComputeSpeedPenaltyFromEffectiveWeight(float effectiveWeight)
     {
         float ratio = Math.Clamp(effectiveWeight / SCR_RSS_Constants.CHARACTER_WEIGHT, 0.0, 2.0);
@@ -31,14 +36,24 @@ class SCR_RSS_EncumbranceCache
 
     // ==================== 状态变量 ====================
     protected float m_fCachedCurrentWeight = 0.0; // 缓存的当前重量（kg）
+    protected float m_fDerivedForWeight = -1.0; // 派生值（惩罚/倍数）对应的重量；-1 表示未计算
+    protected int m_iDerivedConfigEpoch = -1; // 派生值所依据的配置纪元（负重系数随预设/管理员改参变化）
     protected float m_fCachedEncumbranceSpeedPenalty = 0.0; // 缓存的速度惩罚
     protected float m_fCachedBodyMassPercent = 0.0; // 缓存的有效负重占体重百分比
     protected float m_fCachedEncumbranceStaminaDrainMultiplier = 1.0; // 缓存的体力消耗倍数
     protected bool m_bEncumbranceCacheValid = false; // 缓存是否有效
     protected SCR_CharacterInventoryStorageComponent m_pCachedInventoryComponent; // 缓存的库存组件引用
     protected SCR_InventoryStorageManagerComponent m_pCachedInventoryManager; // 缓存的库存管理器组件（避免每 tick FindComponent）
-    protected float m_fLastCheckTime = 0.0; // 上次检查时间（秒）
-    protected const float ENCUMBRANCE_CHECK_INTERVAL = 0.5; // 轮询间隔（秒），perf: 0.2→0.5，事件驱动已覆盖变更
+    protected float m_fLastCheckTime = 0.0; // 上次对账时间（秒）
+    protected const float ENCUMBRANCE_VERIFY_INTERVAL = 2.0; // 对账间隔（秒）；库存变更由事件增量驱动，此处兜底弹匣打空等无事件变化
+    protected const float ENCUMBRANCE_VERIFY_TOLERANCE_KG = 0.1; // 对账容差（kg），超出则以全量值为准
+    protected const float ENCUMBRANCE_DERIVED_EPSILON_KG = 0.001; // 重量变化小于此值不重算惩罚多项式
+    protected const int NESTED_ANCESTOR_MAX_DEPTH = 8; // 嵌套去重时沿实体层级上溯的最大层数
+
+    // 本 tick 已计入的库存事件（CheckAndUpdate 时清空），用于嵌套事件去重
+    protected ref array<IEntity> m_aTickItems = {};
+    protected ref array<float> m_aTickSigns = {};
+    protected ref array<float> m_aTickWeights = {};
 
     // ==================== 公共方法 ====================
     
@@ -47,12 +62,15 @@ class SCR_RSS_EncumbranceCache
     void Initialize(SCR_CharacterInventoryStorageComponent inventoryComponent = null)
     {
         m_fCachedCurrentWeight = 0.0;
+        m_fDerivedForWeight = -1.0;
+        m_iDerivedConfigEpoch = -1;
         m_fCachedEncumbranceSpeedPenalty = 0.0;
         m_fCachedBodyMassPercent = 0.0;
         m_fCachedEncumbranceStaminaDrainMultiplier = 1.0;
         m_bEncumbranceCacheValid = false;
         m_pCachedInventoryComponent = inventoryComponent;
         m_pCachedInventoryManager = null;
+        ClearTickItems();
 
         // 如果提供了库存组件，初始化时计算一次负重
         if (m_pCachedInventoryComponent)
@@ -71,126 +89,204 @@ class SCR_RSS_EncumbranceCache
             m_bEncumbranceCacheValid = false;
     }
     
-    // 更新缓存（事件驱动）
-    // 仅在库存变化时调用，避免每0.2秒重复计算
-    // 注意：需要在库存组件的事件中调用此方法（如 OnItemAdded/OnItemRemoved）
+    // 全量重建缓存（初始化 / 对账失配 / 尚无基准时）
+    // 库存增减事件请走 ApplyItemDelta，避免全量扫描
     void UpdateCache()
     {
-        if (!m_pCachedInventoryComponent)
+        float currentWeight = ReadTotalWeight();
+        if (currentWeight < 0.0)
         {
             m_bEncumbranceCacheValid = false;
             return;
         }
-        
-        float currentWeight = 0.0;
-        
-        // 获取角色实体
-        IEntity ownerEntity = m_pCachedInventoryComponent.GetOwner();
-        if (!ownerEntity)
+
+        SetCurrentWeight(currentWeight);
+        ClearTickItems();
+        if (GetGame() && GetGame().GetWorld())
+            m_fLastCheckTime = GetGame().GetWorld().GetWorldTime() / 1000.0;
+    }
+
+    //! 库存事件增量：物品总重按符号计入；同 tick 内与已计入的同号祖先/子物品去重
+    //! @param item 被添加/移除的物品实体（移除事件触发时实体仍有效）
+    //! @param sign +1 = 添加，-1 = 移除
+    void ApplyItemDelta(IEntity item, float sign)
+    {
+        if (!m_pCachedInventoryComponent)
+            return;
+
+        // 尚无基准：直接全量建立
+        if (!m_bEncumbranceCacheValid)
         {
-            m_bEncumbranceCacheValid = false;
+            UpdateCache();
             return;
         }
-        
-        // 使用 SCR_InventoryStorageManagerComponent.GetTotalWeightOfAllStorages() 方法（唯一方式）
-        if (!m_pCachedInventoryManager)
-            m_pCachedInventoryManager = SCR_InventoryStorageManagerComponent.Cast(ownerEntity.FindComponent(SCR_InventoryStorageManagerComponent));
-        if (m_pCachedInventoryManager)
+
+        if (!item)
+            return;
+
+        // 祖先已按同号计入：其总重已含本物品
+        int count = m_aTickItems.Count();
+        for (int i = 0; i < count; i++)
         {
-            // 使用官方推荐的 GetTotalWeightOfAllStorages() 方法，确保计算所有存储的重量
-            currentWeight = m_pCachedInventoryManager.GetTotalWeightOfAllStorages();
+            if (m_aTickSigns[i] == sign && IsNestedIn(item, m_aTickItems[i]))
+                return;
         }
-        else
+
+        float delta = sign * GetItemTotalWeight(item);
+
+        // 子物品先到：本物品总重已含它们，扣回并移出记录
+        for (int j = count - 1; j >= 0; j--)
         {
-            // 如果无法获取 inventoryManager，设置缓存无效
-            m_bEncumbranceCacheValid = false;
-            if (SCR_RSS_ConfigBridge.IsDebugEnabled())
-                Print("[RSS] UpdateCache - 无法获取 SCR_InventoryStorageManagerComponent");
-            return;
+            if (m_aTickSigns[j] == sign && IsNestedIn(m_aTickItems[j], item))
+            {
+                delta -= sign * m_aTickWeights[j];
+                m_aTickItems.Remove(j);
+                m_aTickSigns.Remove(j);
+                m_aTickWeights.Remove(j);
+            }
         }
-        
-        if (currentWeight < 0.0)
+
+        m_aTickItems.Insert(item);
+        m_aTickSigns.Insert(sign);
+        m_aTickWeights.Insert(sign * delta);
+
+        if (delta == 0.0)
+            return;
+
+        float newWeight = m_fCachedCurrentWeight + delta;
+        if (newWeight < 0.0)
         {
-            m_bEncumbranceCacheValid = false;
+            // 增量失配（事件顺序异常）：以全量值为准
+            UpdateCache();
             return;
         }
-        
-        // 更新缓存值
-        m_fCachedCurrentWeight = currentWeight;
-
-        // 计算有效负重（负载 = 载具/装备重量 - 基准装备重量）
-        // GetTotalWeightOfAllStorages() 返回的是装备/背包重量，不含身体重量
-        float effectiveWeight = Math.Max(currentWeight - SCR_RSS_Constants.BASE_WEIGHT, 0.0);
-        m_fCachedBodyMassPercent = effectiveWeight / SCR_RSS_Constants.CHARACTER_WEIGHT;
-        m_fCachedEncumbranceSpeedPenalty = ComputeSpeedPenaltyFromEffectiveWeight(effectiveWeight);
-        
-        // 计算体力消耗倍数
-        float encumbranceStaminaDrainCoeff = SCR_RSS_ConfigBridge.GetEncumbranceStaminaDrainCoeff();
-        m_fCachedEncumbranceStaminaDrainMultiplier = 1.0 + (encumbranceStaminaDrainCoeff * m_fCachedBodyMassPercent);
-        m_fCachedEncumbranceStaminaDrainMultiplier = Math.Clamp(m_fCachedEncumbranceStaminaDrainMultiplier, 1.0, 3.0);
-        
-        m_bEncumbranceCacheValid = true;
+        SetCurrentWeight(newWeight);
     }
-    
-    // 检查并更新缓存（仅在变化时更新）
-    // 在 UpdateSpeedBasedOnStamina 中调用，检查负重是否变化
-    // 性能优化：按 ENCUMBRANCE_CHECK_INTERVAL 节流，减少 GetTotalWeightOfAllStorages 调用频率
+
+    // 低频对账（在 UpdateSpeedBasedOnStamina 中调用）
+    // 增量记账已覆盖库存变更；此处仅按 ENCUMBRANCE_VERIFY_INTERVAL 校验一次总重，
+    // 纠正无库存事件的重量变化。
     void CheckAndUpdate()
     {
         if (!m_pCachedInventoryComponent)
             return;
 
+        // 嵌套去重只在同一 tick 内有效
+        if (!m_aTickItems.IsEmpty())
+            ClearTickItems();
+
+        // 重量未变但配置纪元变了：按新系数重算派生值
+        if (m_bEncumbranceCacheValid && m_iDerivedConfigEpoch != SCR_RSS_ConfigManager.GetConfigEpoch())
+            SetCurrentWeight(m_fCachedCurrentWeight);
+
         float currentTime = GetGame().GetWorld().GetWorldTime() / 1000.0;
-        if (m_bEncumbranceCacheValid && (currentTime - m_fLastCheckTime < ENCUMBRANCE_CHECK_INTERVAL))
+        if (m_bEncumbranceCacheValid && (currentTime - m_fLastCheckTime < ENCUMBRANCE_VERIFY_INTERVAL))
             return;
         m_fLastCheckTime = currentTime;
-        
-        float currentWeight = 0.0;
-        
-        // 获取角色实体
-        IEntity ownerEntity = m_pCachedInventoryComponent.GetOwner();
-        if (ownerEntity)
-        {
-            if (!m_pCachedInventoryManager)
-                m_pCachedInventoryManager = SCR_InventoryStorageManagerComponent.Cast(ownerEntity.FindComponent(SCR_InventoryStorageManagerComponent));
-            if (m_pCachedInventoryManager)
-            {
-                currentWeight = m_pCachedInventoryManager.GetTotalWeightOfAllStorages();
-            }
-            else
-            {
-                // 回退方案：手动计算所有必要存储的重量
-                array<BaseInventoryStorageComponent> storages = {};
-                
-                // 按照官方 GetTotalWeightOfAllStorages() 方法的逻辑，手动添加必要的存储
-                BaseInventoryStorageComponent weaponStorage = m_pCachedInventoryComponent.GetWeaponStorage();
-                if (weaponStorage)
-                    storages.Insert(weaponStorage); // 主副武器插槽（仅非空时添加）
-                storages.Insert(m_pCachedInventoryComponent);                    // 衣服、背包、背心里的东西
-                
-                // 遍历所有存储，累加重量
-                foreach (BaseInventoryStorageComponent storage : storages)
-                {
-                    if (storage)
-                        currentWeight += storage.GetTotalWeight();
-                }
-            }
-        }
-        else
+
+        float currentWeight = ReadTotalWeight();
+        if (currentWeight < 0.0)
         {
             // CRITICAL FIX: owner entity is null, mark cache invalid immediately.
-            // Previously the fallback calculation could keep the cache nominally
-            // valid when weight hadn't changed beyond the 0.1kg threshold.
             m_bEncumbranceCacheValid = false;
             return;
         }
-        
-        // 如果重量变化超过0.1kg，重新计算缓存（避免微小浮点误差触发）
-        if (Math.AbsFloat(currentWeight - m_fCachedCurrentWeight) > 0.1 || !m_bEncumbranceCacheValid)
+
+        // 如果重量偏差超过容差，以全量值为准（避免微小浮点误差触发）
+        if (Math.AbsFloat(currentWeight - m_fCachedCurrentWeight) > ENCUMBRANCE_VERIFY_TOLERANCE_KG || !m_bEncumbranceCacheValid)
         {
-            UpdateCache();
+            if (m_bEncumbranceCacheValid && SCR_RSS_ConfigBridge.IsDebugEnabled())
+                PrintFormat("[RSS] Encumbrance verify drift: cached=%1 actual=%2", m_fCachedCurrentWeight, currentWeight);
+            SetCurrentWeight(currentWeight);
         }
     }
+
+    // ==================== 内部方法 ====================
+
+    //! 全量读取装备总重（kg）；失败返回 -1
+    protected float ReadTotalWeight()
+    {
+        if (!m_pCachedInventoryComponent)
+            return -1.0;
+
+        IEntity ownerEntity = m_pCachedInventoryComponent.GetOwner();
+        if (!ownerEntity)
+            return -1.0;
+
+        // 使用 SCR_InventoryStorageManagerComponent.GetTotalWeightOfAllStorages() 方法（官方推荐）
+        if (!m_pCachedInventoryManager)
+            m_pCachedInventoryManager = SCR_InventoryStorageManagerComponent.Cast(ownerEntity.FindComponent(SCR_InventoryStorageManagerComponent));
+        if (m_pCachedInventoryManager)
+            return m_pCachedInventoryManager.GetTotalWeightOfAllStorages();
+
+        // 回退方案：按官方 GetTotalWeightOfAllStorages() 的逻辑手动累加必要存储
+        if (SCR_RSS_ConfigBridge.IsDebugEnabled())
+            Print("[RSS] ReadTotalWeight - 无法获取 SCR_InventoryStorageManagerComponent，回退手动累加");
+        float total = m_pCachedInventoryComponent.GetTotalWeight(); // 衣服、背包、背心里的东西
+        BaseInventoryStorageComponent weaponStorage = m_pCachedInventoryComponent.GetWeaponStorage();
+        if (weaponStorage)
+            total += weaponStorage.GetTotalWeight(); // 主副武器插槽
+        return total;
+    }
+
+    //! 物品总重（含附件与嵌套容器内容）
+    protected static float GetItemTotalWeight(IEntity item)
+    {
+        if (!item)
+            return 0.0;
+        InventoryItemComponent itemComp = InventoryItemComponent.Cast(item.FindComponent(InventoryItemComponent));
+        if (!itemComp)
+            return 0.0;
+        return itemComp.GetTotalWeight();
+    }
+
+    //! item 当前是否挂在 container 的实体层级之下
+    protected static bool IsNestedIn(IEntity item, IEntity container)
+    {
+        if (!item || !container)
+            return false;
+        IEntity parent = item.GetParent();
+        for (int depth = 0; parent && depth < NESTED_ANCESTOR_MAX_DEPTH; depth++)
+        {
+            if (parent == container)
+                return true;
+            parent = parent.GetParent();
+        }
+        return false;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void ClearTickItems()
+    {
+        m_aTickItems.Clear();
+        m_aTickSigns.Clear();
+        m_aTickWeights.Clear();
+    }
+
+    //! 写入重量；派生值仅在重量实际变化或配置纪元变化时重算
+    protected void SetCurrentWeight(float currentWeight)
+    {
+        m_fCachedCurrentWeight = currentWeight;
+        m_bEncumbranceCacheValid = true;
+
+        int epoch = SCR_RSS_ConfigManager.GetConfigEpoch();
+        if (m_fDerivedForWeight >= 0.0 && epoch == m_iDerivedConfigEpoch
+            && Math.AbsFloat(currentWeight - m_fDerivedForWeight) < ENCUMBRANCE_DERIVED_EPSILON_KG)
+            return;
+        m_fDerivedForWeight = currentWeight;
+        m_iDerivedConfigEpoch = epoch;
+
+        // 计算有效负重（负载 = 载具/装备重量 - 基准装备重量）
+        // GetTotalWeightOfAllStorages() 返回的是装备/背包重量，不含身体重量
+        float effectiveWeight = Math.Max(currentWeight - SCR_RSS_Constants.BASE_WEIGHT, 0.0);
+        m_fCachedBodyMassPercent = effectiveWeight / SCR_RSS_Constants.CHARACTER_WEIGHT;
+        m_fCachedEncumbranceSpeedPenalty = ComputeSpeedPenaltyFromEffectiveWeight(effectiveWeight);
+        
+        // 计算体力消耗倍数
+        float encumbranceStaminaDrainCoeff = SCR_RSS_ConfigBridge.GetEncumbranceStaminaDrainCoeff();
+        m_fCachedEncumbranceStaminaDrainMultiplier = 1.0 + (encumbranceStaminaDrainCoeff * m_fCachedBodyMassPercent);
+        m_fCachedEncumbranceStaminaDrainMultiplier = Math.Clamp(m_fCachedEncumbranceStaminaDrainMultiplier, 1.0, 3.0);
+    }
     
     // ==================== 获取缓存值的方法 ====================
     
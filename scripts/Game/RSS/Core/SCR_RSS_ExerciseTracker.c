@@ -29,14 +29,15 @@ class SCR_RSS_ExerciseTracker
     // @param currentTime 当前世界时间（毫秒）
     // @param isCurrentlyMoving 当前是否在移动（速度 > 0.05 m/s）
     // @param isInVehicle 是否在载具中；载具内从运动转为静止时保留休息进度，不重置（避免上车后 ETA 从 1 分钟突增为 4 分钟）
-    void Update(float currentTime, bool isCurrentlyMoving, bool isInVehicle = false)
+    //! @param maxDeltaSec 单次累积上限；降频调用方（载具 1 Hz）传入自身的最大区间
+    void Update(float currentTime, bool isCurrentlyMoving, bool isInVehicle = false, float maxDeltaSec = 0.5)
     {
         float currentTimeSeconds = currentTime / 1000.0; // 转换为秒
         
         // v3.20.4：统一用 Clamp 处理帧间时间差，防止服务器卡顿/帧率波动导致的大 delta
-        // 上限 0.5s（约 2fps 时的帧间距），超出部分视为异常帧，截断而非丢弃，保证累积连续性
+        // 上限默认 0.5s（约 2fps 时的帧间距），超出部分视为异常帧，截断而非丢弃，保证累积连续性
         float rawDelta = currentTimeSeconds - m_fLastUpdateTime;
-        float clampedDelta = Math.Clamp(rawDelta, 0.0, 0.5);
+        float clampedDelta = Math.Clamp(rawDelta, 0.0, maxDeltaSec);
 
         if (isCurrentlyMoving)
         {
@@ -0,0 +1,215 @@
+//! 高度图预测坡度估计器：沿前进方向在缓存高度格上取若干前瞻点，一次调用同时给出平滑坡度与短时预测坡度
+//!
+//! 现有坡度来自瞬时地面法线 × 速度投影，再经 RSS_SmoothGradePercentForSpeed 的 EMA——只能在上坡后才反应。
+//! 这里改为沿航向取高度差：当前坡度 = 脚下 ±BASE_HALF_M 中心差分；预测坡度 = 脚下与 LOOKAHEAD_POINTS 个
+//! 前瞻点（间距按 HORIZON_SEC 内的行进距离）的最小二乘斜率。高度取自世界级高度格（格点查询一次后共享，
+//! 双线性插值），同格实体与相邻 tick 不再重复查地形。
+//! 每实体一个实例，持有平滑状态；由 SCR_RSS_SpeedCalculator.SampleSlope 在移动中每 tick 调用一次，
+//! 代谢坡度、限速坡度与预测坡度都取自这一次估计，移动中不再查地面法线。
+//! 乘车期间由主循环 Reset；两次调用间位移超过 TELEPORT_RESET_M（传送、复活）时自动重置平滑状态。
+//! 离线精度对照见 tools/test_grade_estimator.py；公式改动需同步。
+
+class SCR_RSS_GradeEstimate
+{
+    //! 本次中心差分坡度（%，未平滑）
+    float m_fRawGradePercent;
+    //! 平滑后的当前坡度（%）
+    float m_fGradePercent;
+    //! HORIZON_SEC 内前方路段坡度（%）
+    float m_fForecastGradePercent;
+}
+
+class SCR_RSS_GradeEstimator
+{
+    static const bool ENABLED = true;
+    //! 高度格边长（m）；合成地形回放下 4 m 与 2 m 精度相当，格点查询约减半（tools/test_grade_estimator.py）
+    static const float CELL_SIZE_M = 4.0;
+    static const int MAX_CELLS = 16384;
+    //! 当前坡度中心差分半基线（m）
+    static const float BASE_HALF_M = 1.5;
+    //! 前瞻点数与时域；点距 = 速度 × HORIZON_SEC / LOOKAHEAD_POINTS，钳到 [MIN_STEP_M, MAX_STEP_M]
+    static const int LOOKAHEAD_POINTS = 3;
+    static const float HORIZON_SEC = 2.0;
+    static const float MIN_STEP_M = 1.0;
+    static const float MAX_STEP_M = 4.0;
+    //! 平滑时间常数（s）与变化速率上限（%/s）；高度差分本身无法线噪声，tau 短于法线 EMA 的 0.55
+    static const float SMOOTH_TAU_SEC = 0.35;
+    static const float MAX_DELTA_PCT_PER_SEC = 55.0;
+    //! 限速用坡度 = 平滑坡度 + ANTICIPATION × (预测 − 平滑)
+    static const float ANTICIPATION = 0.5;
+    //! 水平速度低于此值视为静止（与 SpeedCalculator 的上下坡判定阈值一致）
+    static const float HEADING_SPEED_MIN_MS = 0.1;
+    //! 相邻两次估计间位移超过此值（m）视为传送，丢弃平滑状态
+    static const float TELEPORT_RESET_M = 25.0;
+
+    protected static const int CELL_KEY_SPAN = 32768;
+    protected static const int CELL_KEY_MASK = 32767;
+
+    protected static BaseWorld s_pWorld;
+    protected static ref map<int, float> s_mHeightByNode;
+
+    protected ref SCR_RSS_GradeEstimate m_pLast;
+    protected bool m_bInitialized = false;
+    protected float m_fLastTimeSec = -1.0;
+    protected vector m_vLastPos;
+
+    //------------------------------------------------------------------------------------------------
+    void SCR_RSS_GradeEstimator()
+    {
+        m_pLast = new SCR_RSS_GradeEstimate();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 一次调用给出平滑坡度与预测坡度；同一 currentTimeSec 重复调用返回同一结果
+    //! \param velocity 速度矢量（水平分量决定航向与前瞻距离；静止时坡度按 0 平滑）
+    SCR_RSS_GradeEstimate Estimate(vector pos, vector velocity, float currentTimeSec, BaseWorld world)
+    {
+        if (m_bInitialized && currentTimeSec == m_fLastTimeSec)
+            return m_pLast;
+        if (m_bInitialized && vector.DistanceSq(pos, m_vLastPos) > TELEPORT_RESET_M * TELEPORT_RESET_M)
+            Reset();
+        m_vLastPos = pos;
+
+        float rawPct = 0.0;
+        float forecastPct = 0.0;
+        vector heading = velocity;
+        heading[1] = 0.0;
+        float speed = heading.Length();
+        if (world && speed >= HEADING_SPEED_MIN_MS)
+        {
+            heading = heading * (1.0 / speed);
+            rawPct = SampleCurrentGrade(pos, heading, world);
+            forecastPct = SampleForecastGrade(pos, heading, speed, world);
+        }
+        m_pLast.m_fRawGradePercent = rawPct;
+        m_pLast.m_fForecastGradePercent = forecastPct;
+
+        if (!m_bInitialized)
+        {
+            m_bInitialized = true;
+            m_fLastTimeSec = currentTimeSec;
+            m_pLast.m_fGradePercent = rawPct;
+            return m_pLast;
+        }
+
+        float dt = Math.Clamp(currentTimeSec - m_fLastTimeSec, 0.01, 0.5);
+        m_fLastTimeSec = currentTimeSec;
+
+        float prev = m_pLast.m_fGradePercent;
+        float target = rawPct;
+        float maxStep = MAX_DELTA_PCT_PER_SEC * dt;
+        if (target - prev > maxStep)
+            target = prev + maxStep;
+        else if (target - prev < -maxStep)
+            target = prev - maxStep;
+        float alpha = dt / (SMOOTH_TAU_SEC + dt);
+        m_pLast.m_fGradePercent = prev + (target - prev) * alpha;
+        return m_pLast;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 限速用坡度：按预测坡度提前量修正平滑坡度
+    static float BlendForSpeedCap(SCR_RSS_GradeEstimate est)
+    {
+        if (!est)
+            return 0.0;
+        return est.m_fGradePercent + ANTICIPATION * (est.m_fForecastGradePercent - est.m_fGradePercent);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 丢弃平滑状态（乘车期间、传送等位置跳变后）
+    void Reset()
+    {
+        m_bInitialized = false;
+        m_fLastTimeSec = -1.0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 缓存高度格上的双线性插值高度
+    static float GetHeight(float x, float z, BaseWorld world)
+    {
+        float gx = x / CELL_SIZE_M;
+        float gz = z / CELL_SIZE_M;
+        int ix = Math.Floor(gx);
+        int iz = Math.Floor(gz);
+        float fx = gx - ix;
+        float fz = gz - iz;
+
+        float h00 = GetNodeHeight(ix, iz, world);
+        float h10 = GetNodeHeight(ix + 1, iz, world);
+        float h01 = GetNodeHeight(ix, iz + 1, world);
+        float h11 = GetNodeHeight(ix + 1, iz + 1, world);
+        float h0 = h00 + (h10 - h00) * fx;
+        float h1 = h01 + (h11 - h01) * fx;
+        return h0 + (h1 - h0) * fz;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float GetNodeHeight(int ix, int iz, BaseWorld world)
+    {
+        if (!ENABLED)
+            return QueryTerrainY(ix * CELL_SIZE_M, iz * CELL_SIZE_M, world);
+
+        if (!s_mHeightByNode || s_pWorld != world)
+        {
+            s_mHeightByNode = new map<int, float>();
+            s_pWorld = world;
+        }
+
+        int key = (ix & CELL_KEY_MASK) * CELL_KEY_SPAN + (iz & CELL_KEY_MASK);
+        float h;
+        if (s_mHeightByNode.Find(key, h))
+            return h;
+
+        h = QueryTerrainY(ix * CELL_SIZE_M, iz * CELL_SIZE_M, world);
+        if (s_mHeightByNode.Count() >= MAX_CELLS)
+            s_mHeightByNode.Clear();
+        s_mHeightByNode.Insert(key, h);
+        return h;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float QueryTerrainY(float x, float z, BaseWorld world)
+    {
+        vector p = vector.Zero;
+        p[0] = x;
+        p[2] = z;
+        return SCR_TerrainHelper.GetTerrainY(p, world, false, null);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 脚下 ±BASE_HALF_M 中心差分（%），钳到 ±100%（±45°，与法线路径一致）
+    protected static float SampleCurrentGrade(vector pos, vector heading, BaseWorld world)
+    {
+        float hBack = GetHeight(pos[0] - heading[0] * BASE_HALF_M, pos[2] - heading[2] * BASE_HALF_M, world);
+        float hFront = GetHeight(pos[0] + heading[0] * BASE_HALF_M, pos[2] + heading[2] * BASE_HALF_M, world);
+        float ratio = (hFront - hBack) / (2.0 * BASE_HALF_M);
+        return Math.Clamp(ratio, -1.0, 1.0) * 100.0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 脚下与前瞻点高度的最小二乘斜率（%）
+    protected static float SampleForecastGrade(vector pos, vector heading, float speed, BaseWorld world)
+    {
+        float step = Math.Clamp(speed * HORIZON_SEC / LOOKAHEAD_POINTS, MIN_STEP_M, MAX_STEP_M);
+        float sumD = 0.0;
+        float sumH = 0.0;
+        float sumDD = 0.0;
+        float sumDH = 0.0;
+        for (int k = 0; k <= LOOKAHEAD_POINTS; k++)
+        {
+            float d = k * step;
+            float h = GetHeight(pos[0] + heading[0] * d, pos[2] + heading[2] * d, world);
+            sumD += d;
+            sumH += h;
+            sumDD += d * d;
+            sumDH += d * h;
+        }
+        float n = LOOKAHEAD_POINTS + 1;
+        float denom = n * sumDD - sumD * sumD;
+        if (denom < 0.0001)
+            return 0.0;
+        float ratio = (n * sumDH - sumD * sumH) / denom;
+        return Math.Clamp(ratio, -1.0, 1.0) * 100.0;
+    }
+}
@@ -0,0 +1,144 @@
+//! 单 tick 代谢上下文：W′ 记账、EPOC 采样、疲劳积分、代谢/W′ 超速帽与基础消耗共用同一组代谢量
+//!
+//! MetabolismPowerWatts 按完整入参（速度/总重/坡度/地形/相位）记忆：同 tick 内入参相同只求值一次，
+//! 入参不同（泥泞地形修正、室内坡度归零、意图速度 ≠ 实测速度）照常计算，不改变任何模型语义。
+//! TickPower 之后冻结 CP、W′ 池与施密特武装态，超速判定与 EPOC/巡航帽读同一份。
+
+class SCR_RSS_MetabolicTickContext
+{
+    //! 同 tick 不同入参的功率求值数（实测/意图速度 × 两种相位 足够）
+    static const int POWER_MEMO_SLOTS = 4;
+
+    protected ref array<float> m_aSpeedMs;
+    protected ref array<float> m_aWeightKg;
+    protected ref array<float> m_aGradePct;
+    protected ref array<float> m_aTerrain;
+    protected ref array<int> m_aPhase;
+    protected ref array<float> m_aPowerW;
+    protected int m_iPowerCount = 0;
+    protected int m_iPowerNext = 0;
+
+    protected bool m_bPostTickCaptured = false;
+    protected float m_fCriticalPowerWatts = -1.0;
+    protected float m_fPool01 = 1.0;
+    protected bool m_bOverspeedArmed = false;
+
+    protected bool m_bWPrimeCapResolved = false;
+    protected float m_fWPrimeCapMs = -1.0;
+
+    //------------------------------------------------------------------------------------------------
+    void SCR_RSS_MetabolicTickContext()
+    {
+        m_aSpeedMs = new array<float>();
+        m_aWeightKg = new array<float>();
+        m_aGradePct = new array<float>();
+        m_aTerrain = new array<float>();
+        m_aPhase = new array<int>();
+        m_aPowerW = new array<float>();
+        m_aSpeedMs.Resize(POWER_MEMO_SLOTS);
+        m_aWeightKg.Resize(POWER_MEMO_SLOTS);
+        m_aGradePct.Resize(POWER_MEMO_SLOTS);
+        m_aTerrain.Resize(POWER_MEMO_SLOTS);
+        m_aPhase.Resize(POWER_MEMO_SLOTS);
+        m_aPowerW.Resize(POWER_MEMO_SLOTS);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 开始：丢弃上一 tick 的记忆
+    void Begin()
+    {
+        m_iPowerCount = 0;
+        m_iPowerNext = 0;
+        m_bPostTickCaptured = false;
+        m_fCriticalPowerWatts = -1.0;
+        m_fPool01 = 1.0;
+        m_bOverspeedArmed = false;
+        m_bWPrimeCapResolved = false;
+        m_fWPrimeCapMs = -1.0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 等价于 MetabolismPowerWatts(v, w, g, t, true, phase)，同 tick 同入参只算一次
+    float PowerWatts(float speedMs, float totalWeightKg, float gradePercent, float terrainFactor, int movementPhase)
+    {
+        for (int i = 0; i < m_iPowerCount; i++)
+        {
+            if (m_aSpeedMs[i] == speedMs && m_aWeightKg[i] == totalWeightKg
+                && m_aGradePct[i] == gradePercent && m_aTerrain[i] == terrainFactor
+                && m_aPhase[i] == movementPhase)
+                return m_aPowerW[i];
+        }
+
+        float powerW = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+            speedMs, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+
+        int slot = m_iPowerNext;
+        m_aSpeedMs[slot] = speedMs;
+        m_aWeightKg[slot] = totalWeightKg;
+        m_aGradePct[slot] = gradePercent;
+        m_aTerrain[slot] = terrainFactor;
+        m_aPhase[slot] = movementPhase;
+        m_aPowerW[slot] = powerW;
+        m_iPowerNext = (slot + 1) % POWER_MEMO_SLOTS;
+        if (m_iPowerCount < POWER_MEMO_SLOTS)
+            m_iPowerCount++;
+        return powerW;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! TickPower 之后调用一次：冻结本 tick 的 CP / W′ 池 / 超速武装态（施密特只推进一次）
+    //! 无 CP 模型时武装态按池无状态近似（同 IsWPrimePoolAvailableForOverspeed(float)）
+    void CapturePostTick(SCR_RSS_CriticalPowerModel cpModel)
+    {
+        m_bPostTickCaptured = true;
+        if (cpModel)
+        {
+            m_fCriticalPowerWatts = cpModel.GetEffectiveCriticalPowerWatts();
+            m_fPool01 = cpModel.GetPool01();
+            m_bOverspeedArmed = SCR_RSS_DrainCalculator.IsWPrimePoolAvailableForOverspeed(cpModel);
+            return;
+        }
+        m_fCriticalPowerWatts = -1.0;
+        m_fPool01 = 1.0;
+        m_bOverspeedArmed = SCR_RSS_DrainCalculator.IsWPrimePoolAvailableForOverspeed(m_fPool01);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsPostTickCaptured()
+    {
+        return m_bPostTickCaptured;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float GetCriticalPowerWatts()
+    {
+        return m_fCriticalPowerWatts;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float GetPool01()
+    {
+        return m_fPool01;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsOverspeedArmed()
+    {
+        return m_bOverspeedArmed;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! W′ 耗尽巡航帽（GetWPrimeExhaustedOverspeedCapMs 门控之后的部分）：入参在 tick 内不变，只解一次
+    bool TryGetWPrimeCapMs(out float capMs)
+    {
+        capMs = m_fWPrimeCapMs;
+        return m_bWPrimeCapResolved;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void StoreWPrimeCapMs(float capMs)
+    {
+        m_fWPrimeCapMs = capMs;
+        m_bWPrimeCapResolved = true;
+    }
+}
@@ -187,6 +187,7 @@ class SCR_RSS_MetabolismModel
     }
 
     //! 综合代谢功率（W），含负重代谢阻尼（与 Rust twin 对齐）
+    //! 表域内走 SCR_RSS_MetabolismTable 插值（误差 ≤ max(2 W, 1%)），表域外精确求值
     static float MetabolismPowerWatts(
         float velocityMs,
         float totalWeightKg,
@@ -194,6 +195,23 @@ class SCR_RSS_MetabolismModel
         float terrainFactor,
         bool useSanteeCorrection,
         int movementPhase)
+    {
+        float tabled;
+        if (SCR_RSS_MetabolismTable.TryLookup(
+                velocityMs, totalWeightKg, gradePercent, terrainFactor, useSanteeCorrection, movementPhase, tabled))
+            return tabled;
+        return MetabolismPowerWattsExact(
+            velocityMs, totalWeightKg, gradePercent, terrainFactor, useSanteeCorrection, movementPhase);
+    }
+
+    //! 精确求值（查表填充与表域外回退用）
+    static float MetabolismPowerWattsExact(
+        float velocityMs,
+        float totalWeightKg,
+        float gradePercent,
+        float terrainFactor,
+        bool useSanteeCorrection,
+        int movementPhase)
     {
         float blended = MetabolismPowerWattsBlended(
             velocityMs, totalWeightKg, gradePercent, terrainFactor, useSanteeCorrection, movementPhase);
@@ -278,12 +296,25 @@ class SCR_RSS_MetabolismModel
     }
 
     //! 反解：给定目标功率，求最大可持续速度（m/s）
+    //! 走 SCR_RSS_SpeedInverseTable 按上下文缓存的正向表；与下方二分一致（见 tools/rss_sim speed_inverse_verify）
     static float InvertSpeedForPowerWatts(
         float targetPowerWatts,
         float totalWeightKg,
         float gradePercent,
         float terrainFactor,
         int movementPhase)
+    {
+        return SCR_RSS_SpeedInverseTable.Lookup(
+            targetPowerWatts, totalWeightKg, gradePercent, terrainFactor, movementPhase);
+    }
+
+    //! 反解精确版：24 步二分（查表的对照基准）
+    static float InvertSpeedForPowerWattsExact(
+        float targetPowerWatts,
+        float totalWeightKg,
+        float gradePercent,
+        float terrainFactor,
+        int movementPhase)
     {
         if (targetPowerWatts <= 1.0)
             return 0.0;
@@ -0,0 +1,257 @@
+//! v6 代谢功率查表：MetabolismPowerWatts 的多线性插值缓存
+//!
+//! 维度：步态类（Walk/Idle 共用、Run、Sprint）× 总重 × 坡度 × 速度，地形系数两平面（t=1 / t=2）。
+//! 各项对地形系数为一次，但 LCDA/阻尼的 max(0) 截断与查表输出的 Math.Max(…, 0) 使功率对地形系数分段线性；
+//! 两平面外推只在截断不触发时精确，故护栏在外推端点上也对照精确值。
+//! 节点与单元按需填充（首次命中时精确求值一次），阻尼系数变化时整表作废，无加载卡顿。
+//!
+//! 误差保证：单元首次使用时以中心点与四条边中点、在地形系数 0.5/1/2/3（查表钳位范围的两端与两平面）上对照精确值，
+//! 任一点误差超过半容差、或跨越已知不连续点
+//! （Walk 的 LCDA→Pandolf 切换、Pandolf 缓下坡 -12% 分界）的单元改走精确路径。
+//! 由此在表域内 |误差| ≤ max(ABS_TOL_W, REL_TOL × P)；对照 tools/rss_sim/src/metabolism_table.rs。
+
+class SCR_RSS_MetabolismTable
+{
+    static const float SPEED_MIN_MS = 0.1;
+    static const float SPEED_STEP_MS = 0.1;
+    static const int SPEED_NODES = 60;          // 0.1 … 6.0 m/s
+    static const float GRADE_MIN_PCT = -30.0;
+    static const float GRADE_STEP_PCT = 1.0;
+    static const int GRADE_NODES = 61;          // -30 … +30 %
+    static const float WEIGHT_MIN_KG = 90.0;
+    static const float WEIGHT_STEP_KG = 5.0;
+    static const int WEIGHT_NODES = 13;         // 90 … 150 kg
+    static const int PHASE_CLASSES = 3;
+    static const int TERRAIN_PLANES = 2;
+
+    //! 查表钳位的地形系数范围（护栏两端探测点）
+    static const float TERRAIN_MIN = 0.5;
+    static const float TERRAIN_MAX = 3.0;
+
+    static const float ABS_TOL_W = 2.0;
+    static const float REL_TOL = 0.01;
+
+    protected static const int CELL_UNKNOWN = 0;
+    protected static const int CELL_TABLE = 1;
+    protected static const int CELL_EXACT = 2;
+
+    //! 每个 (步态类, 重量节点) 一块：节点值（-1 = 未求值）与单元状态
+    protected static ref array<ref array<float>> s_aSlabNodes;
+    protected static ref array<ref array<int>> s_aSlabCells;
+    protected static float s_fDampeningKey = -1.0;
+
+    //------------------------------------------------------------------------------------------------
+    //! 表域内返回 true 并写出插值功率；表域外（低速/极端坡度/超重/非标准步态）返回 false
+    static bool TryLookup(
+        float velocityMs,
+        float totalWeightKg,
+        float gradePercent,
+        float terrainFactor,
+        bool useSanteeCorrection,
+        int movementPhase,
+        out float outPowerWatts)
+    {
+        outPowerWatts = 0.0;
+        if (!useSanteeCorrection)
+            return false;
+
+        int phaseClass = PhaseClassOf(movementPhase);
+        if (phaseClass < 0)
+            return false;
+
+        // 体重+0.5 kg 以内阻尼不生效（与精确路径分支一致），直接求值
+        if (totalWeightKg <= SCR_RSS_Constants.CHARACTER_WEIGHT + 0.5)
+            return false;
+
+        float fv = (velocityMs - SPEED_MIN_MS) / SPEED_STEP_MS;
+        float fg = (gradePercent - GRADE_MIN_PCT) / GRADE_STEP_PCT;
+        float fw = (totalWeightKg - WEIGHT_MIN_KG) / WEIGHT_STEP_KG;
+        if (fv < 0.0 || fv > SPEED_NODES - 1 || fg < 0.0 || fg > GRADE_NODES - 1 || fw < 0.0 || fw > WEIGHT_NODES - 1)
+            return false;
+
+        EnsureDampeningKey();
+
+        int iv = Math.Floor(fv);
+        if (iv > SPEED_NODES - 2)
+            iv = SPEED_NODES - 2;
+        int ig = Math.Floor(fg);
+        if (ig > GRADE_NODES - 2)
+            ig = GRADE_NODES - 2;
+        int iw = Math.Floor(fw);
+        if (iw > WEIGHT_NODES - 2)
+            iw = WEIGHT_NODES - 2;
+
+        int slabLo = phaseClass * WEIGHT_NODES + iw;
+        int slabHi = slabLo + 1;
+        if (!IsCellTabled(phaseClass, slabLo, iw, iv, ig))
+            return false;
+        if (!IsCellTabled(phaseClass, slabHi, iw + 1, iv, ig))
+            return false;
+
+        float a = fv - iv;
+        float b = fg - ig;
+        float c = fw - iw;
+        float t = Math.Clamp(terrainFactor, TERRAIN_MIN, TERRAIN_MAX);
+
+        float p1 = (1.0 - c) * Bilinear(phaseClass, slabLo, iw, 0, iv, ig, a, b)
+            + c * Bilinear(phaseClass, slabHi, iw + 1, 0, iv, ig, a, b);
+        float p2 = (1.0 - c) * Bilinear(phaseClass, slabLo, iw, 1, iv, ig, a, b)
+            + c * Bilinear(phaseClass, slabHi, iw + 1, 1, iv, ig, a, b);
+
+        outPowerWatts = Math.Max(p1 + (p2 - p1) * (t - 1.0), 0.0);
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! Walk/Idle 在精确模型里完全同形，共用一类
+    protected static int PhaseClassOf(int movementPhase)
+    {
+        if (movementPhase == 0 || movementPhase == 1)
+            return 0;
+        if (movementPhase == 2)
+            return 1;
+        if (movementPhase == 3)
+            return 2;
+        return -1;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static void EnsureDampeningKey()
+    {
+        float dampening = SCR_RSS_ConfigBridge.GetLoadMetabolicDampening();
+        if (s_aSlabNodes && dampening == s_fDampeningKey)
+            return;
+
+        s_fDampeningKey = dampening;
+        s_aSlabNodes = new array<ref array<float>>();
+        s_aSlabCells = new array<ref array<int>>();
+        int slabCount = PHASE_CLASSES * WEIGHT_NODES;
+        s_aSlabNodes.Resize(slabCount);
+        s_aSlabCells.Resize(slabCount);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float Bilinear(int phaseClass, int slab, int iw, int plane, int iv, int ig, float a, float b)
+    {
+        float p00 = Node(phaseClass, slab, iw, plane, iv, ig);
+        float p10 = Node(phaseClass, slab, iw, plane, iv + 1, ig);
+        float p01 = Node(phaseClass, slab, iw, plane, iv, ig + 1);
+        float p11 = Node(phaseClass, slab, iw, plane, iv + 1, ig + 1);
+        float lo = p00 + (p10 - p00) * a;
+        float hi = p01 + (p11 - p01) * a;
+        return lo + (hi - lo) * b;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float Node(int phaseClass, int slab, int iw, int plane, int iv, int ig)
+    {
+        array<float> nodes = s_aSlabNodes[slab];
+        if (!nodes)
+        {
+            nodes = new array<float>();
+            int count = TERRAIN_PLANES * GRADE_NODES * SPEED_NODES;
+            nodes.Resize(count);
+            for (int i = 0; i < count; i++)
+            {
+                nodes[i] = -1.0;
+            }
+            s_aSlabNodes[slab] = nodes;
+        }
+
+        int idx = (plane * GRADE_NODES + ig) * SPEED_NODES + iv;
+        float value = nodes[idx];
+        if (value >= 0.0)
+            return value;
+
+        value = Exact(phaseClass, iw, 1.0 + plane, SPEED_MIN_MS + iv * SPEED_STEP_MS, GRADE_MIN_PCT + ig * GRADE_STEP_PCT);
+        nodes[idx] = value;
+        return value;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 单元首次使用时判定：跨不连续点，或中心/四边中点任一误差超半容差 → 精确路径
+    //! （只查中心会漏掉沿一个轴弯曲、另一个轴反向弯曲的单元：中心处两向误差抵消，边中点不会）
+    protected static bool IsCellTabled(int phaseClass, int slab, int iw, int iv, int ig)
+    {
+        array<int> cells = s_aSlabCells[slab];
+        if (!cells)
+        {
+            cells = new array<int>();
+            int count = (GRADE_NODES - 1) * (SPEED_NODES - 1);
+            cells.Resize(count);
+            for (int i = 0; i < count; i++)
+            {
+                cells[i] = CELL_UNKNOWN;
+            }
+            s_aSlabCells[slab] = cells;
+        }
+
+        int idx = ig * (SPEED_NODES - 1) + iv;
+        int state = cells[idx];
+        if (state == CELL_UNKNOWN)
+        {
+            state = CELL_TABLE;
+            if (CellCrossesDiscontinuity(phaseClass, iv, ig))
+                state = CELL_EXACT;
+
+            if (state == CELL_TABLE)
+            {
+                if (!ProbeWithinHalfTol(phaseClass, slab, iw, iv, ig, 0.5, 0.5)
+                    || !ProbeWithinHalfTol(phaseClass, slab, iw, iv, ig, 0.5, 0.0)
+                    || !ProbeWithinHalfTol(phaseClass, slab, iw, iv, ig, 0.5, 1.0)
+                    || !ProbeWithinHalfTol(phaseClass, slab, iw, iv, ig, 0.0, 0.5)
+                    || !ProbeWithinHalfTol(phaseClass, slab, iw, iv, ig, 1.0, 0.5))
+                    state = CELL_EXACT;
+            }
+            cells[idx] = state;
+        }
+        return state == CELL_TABLE;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 单元内 (a, b) 处（a 沿速度、b 沿坡度，0..1）两平面外推值与精确值之差是否在半容差内：
+    //! 地形系数取钳位两端与两平面，截断折点落在外推段时由端点暴露
+    protected static bool ProbeWithinHalfTol(int phaseClass, int slab, int iw, int iv, int ig, float a, float b)
+    {
+        float p1 = Bilinear(phaseClass, slab, iw, 0, iv, ig, a, b);
+        float p2 = Bilinear(phaseClass, slab, iw, 1, iv, ig, a, b);
+        float velocityMs = SPEED_MIN_MS + (iv + a) * SPEED_STEP_MS;
+        float gradePercent = GRADE_MIN_PCT + (ig + b) * GRADE_STEP_PCT;
+        return TerrainWithinHalfTol(phaseClass, iw, velocityMs, gradePercent, p1, p2, TERRAIN_MIN)
+            && TerrainWithinHalfTol(phaseClass, iw, velocityMs, gradePercent, p1, p2, 1.0)
+            && TerrainWithinHalfTol(phaseClass, iw, velocityMs, gradePercent, p1, p2, 2.0)
+            && TerrainWithinHalfTol(phaseClass, iw, velocityMs, gradePercent, p1, p2, TERRAIN_MAX);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static bool TerrainWithinHalfTol(int phaseClass, int iw, float velocityMs, float gradePercent, float p1, float p2, float terrain)
+    {
+        float interp = Math.Max(p1 + (p2 - p1) * (terrain - 1.0), 0.0);
+        float exact = Exact(phaseClass, iw, terrain, velocityMs, gradePercent);
+        float tol = Math.Max(ABS_TOL_W, REL_TOL * Math.AbsFloat(exact));
+        return Math.AbsFloat(interp - exact) <= 0.5 * tol;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static bool CellCrossesDiscontinuity(int phaseClass, int iv, int ig)
+    {
+        float vLo = SPEED_MIN_MS + iv * SPEED_STEP_MS;
+        if (phaseClass == 0
+            && vLo <= SCR_RSS_Constants.LCDA_MAX_SPEED_MS
+            && SCR_RSS_Constants.LCDA_MAX_SPEED_MS <= vLo + SPEED_STEP_MS)
+            return true;
+
+        float gLo = GRADE_MIN_PCT + ig * GRADE_STEP_PCT;
+        float gentleEdge = -SCR_RSS_Constants.GENTLE_DOWNHILL_GRADE_MAX;
+        return gLo <= gentleEdge && gentleEdge <= gLo + GRADE_STEP_PCT;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float Exact(int phaseClass, int iw, float terrain, float velocityMs, float gradePercent)
+    {
+        int phase = phaseClass + 1;
+        float weightKg = WEIGHT_MIN_KG + iw * WEIGHT_STEP_KG;
+        return SCR_RSS_MetabolismModel.MetabolismPowerWattsExact(
+            velocityMs, weightKg, gradePercent, terrain, true, phase);
+    }
+}
@@ -134,11 +134,6 @@ class SCR_RSS_SpeedBridge
         ApplyStaminaSpeedLimit(ctrl.GetOwner(), limit);
     }
 
-    static void ApplyHardStaminaSpeedClamp(IEntity owner, float limit)
-    {
-        ApplyStaminaSpeedLimit(owner, limit);
-    }
-
     //! 绝对速度 → 相对当前相位顶速的 SetSpeedLimit 倍率。
     //! @param keepSource true：禁止返回 1.0（Chimera SetSpeedLimit(1.0) 会移除限速源，
     //!   Run→Walk 时若仍停在 Run 顶速会瞬间窜到 3m/s+）。
@@ -183,51 +178,43 @@ class SCR_RSS_SpeedBridge
         return cap;
     }
 
-    static void ClampOwnerHorizontalSpeed(IEntity owner, float maxHorizMs)
+    //! 硬钳目标速度：超过上限 + 0.04 m/s 余量时压到上限
+    static float HardClampTargetMs(float speedMs, float maxHorizMs)
     {
-        ClampOwnerHorizontalSpeed(owner, maxHorizMs, false);
+        if (maxHorizMs < 0.1)
+            return speedMs;
+        if (speedMs <= maxHorizMs + 0.04)
+            return speedMs;
+        return maxHorizMs;
     }
 
-    //! @param forceIgnoreGlobalFlag true：无视 V6_APPLY_HORIZONTAL_SPEED_CLAMP（仅用于 CP 巡航超速纠偏）
-    static void ClampOwnerHorizontalSpeed(IEntity owner, float maxHorizMs, bool forceIgnoreGlobalFlag)
+    //! 软钳目标速度：超额小时按 HORIZ_SOFT_DECEL_MS2 减速，超额大时同硬钳
+    static float SoftClampTargetMs(float speedMs, float maxHorizMs, float dtSec)
     {
-        if (!forceIgnoreGlobalFlag)
-        {
-            if (!IsHorizontalSpeedClampEnabled())
-                return;
-        }
-        if (!owner)
-            return;
         if (maxHorizMs < 0.1)
-            return;
-
-        Physics physics = owner.GetPhysics();
-        if (!physics)
-            return;
-
-        vector velocity = physics.GetVelocity();
-        float horizSq = velocity[0] * velocity[0] + velocity[2] * velocity[2];
-        float slackMs = 0.04;
-        float slackSq = (maxHorizMs + slackMs) * (maxHorizMs + slackMs);
-        if (horizSq <= slackSq)
-            return;
-        if (horizSq <= 0.0001)
-            return;
+            return speedMs;
+        if (dtSec < 0.01)
+            dtSec = 0.01;
+        if (dtSec > 0.5)
+            dtSec = 0.5;
+        if (speedMs <= maxHorizMs + 0.06)
+            return speedMs;
+        if (speedMs > maxHorizMs + 0.35)
+            return HardClampTargetMs(speedMs, maxHorizMs);
 
-        float speed = Math.Sqrt(horizSq);
-        float scale = maxHorizMs / speed;
-        velocity[0] = velocity[0] * scale;
-        velocity[2] = velocity[2] * scale;
-        physics.SetVelocity(velocity);
+        float newSpeed = speedMs - HORIZ_SOFT_DECEL_MS2 * dtSec;
+        if (newSpeed < maxHorizMs)
+            newSpeed = maxHorizMs;
+        return newSpeed;
     }
 
-    //! 软钳；超额大时硬钳（控制器每帧回灌时软钳不够）
-    static void SoftClampOwnerHorizontalSpeed(IEntity owner, float maxHorizMs, float dtSec)
+    static void ClampOwnerHorizontalSpeed(IEntity owner, float maxHorizMs)
     {
-        SoftClampOwnerHorizontalSpeed(owner, maxHorizMs, dtSec, false);
+        ClampOwnerHorizontalSpeed(owner, maxHorizMs, false);
     }
 
-    static void SoftClampOwnerHorizontalSpeed(IEntity owner, float maxHorizMs, float dtSec, bool forceIgnoreGlobalFlag)
+    //! @param forceIgnoreGlobalFlag true：无视 V6_APPLY_HORIZONTAL_SPEED_CLAMP（仅用于 CP 巡航超速纠偏）
+    static void ClampOwnerHorizontalSpeed(IEntity owner, float maxHorizMs, bool forceIgnoreGlobalFlag)
     {
         if (!forceIgnoreGlobalFlag)
         {
@@ -238,10 +225,6 @@ class SCR_RSS_SpeedBridge
             return;
         if (maxHorizMs < 0.1)
             return;
-        if (dtSec < 0.01)
-            dtSec = 0.01;
-        if (dtSec > 0.5)
-            dtSec = 0.5;
 
         Physics physics = owner.GetPhysics();
         if (!physics)
@@ -253,31 +236,22 @@ class SCR_RSS_SpeedBridge
             return;
 
         float speed = Math.Sqrt(horizSq);
-        float slackMs = 0.06;
-        if (speed <= maxHorizMs + slackMs)
-            return;
-
-        if (speed > maxHorizMs + 0.35)
-        {
-            ClampOwnerHorizontalSpeed(owner, maxHorizMs, forceIgnoreGlobalFlag);
+        float target = HardClampTargetMs(speed, maxHorizMs);
+        if (target >= speed)
             return;
-        }
 
-        float newSpeed = speed - HORIZ_SOFT_DECEL_MS2 * dtSec;
-        if (newSpeed < maxHorizMs)
-            newSpeed = maxHorizMs;
-        float scale = newSpeed / speed;
+        float scale = target / speed;
         velocity[0] = velocity[0] * scale;
         velocity[2] = velocity[2] * scale;
         physics.SetVelocity(velocity);
     }
 
-    //! CP 巡航 / W′ 解除武装后超速纠偏。
+    //! CP 巡航 / W′ 解除武装后超速纠偏（暂存到 stage，tick 末统一落盘）。
     //! @param gradePercent 当前坡度%
     //! @param movementPhase 1=Walk：永不放行下坡滑行（原版 Walk 顶 ≈1.45，不应到 3m/s+）；
     //!   Run/Sprint 缓下坡可小幅滑行，峭壁整段跳过。
     static void EnforceCpCruisePhysicsCap(
-        IEntity owner,
+        SCR_RSS_SpeedOutputStage stage,
         float appliedLimitMs,
         float measuredSpeedMs,
         float dtSec,
@@ -286,6 +260,8 @@ class SCR_RSS_SpeedBridge
     {
         if (!SCR_RSS_Constants.V6_CP_CRUISE_OVERSPEED_PHYSICS_CLAMP)
             return;
+        if (!stage)
+            return;
 
         bool isWalkPhase = false;
         if (movementPhase == 1)
@@ -320,11 +296,11 @@ class SCR_RSS_SpeedBridge
         float hardExcess = 0.25;
         if (isWalkPhase || measuredSpeedMs > appliedLimitMs + hardExcess)
         {
-            ClampOwnerHorizontalSpeed(owner, appliedLimitMs, true);
+            stage.StageHardClamp(appliedLimitMs);
             return;
         }
 
-        SoftClampOwnerHorizontalSpeed(owner, appliedLimitMs, dtSec, true);
+        stage.StageSoftClamp(appliedLimitMs, dtSec);
     }
 
     //! 代谢/CP 反解用坡度：钳到 ±V6_METABOLIC_GRADE_ABS_MAX_PCT
@@ -9,6 +9,19 @@ class GradeCalculationResult
     float slopeAngleDegrees;
 }
 
+// 单 tick 坡度采样（SCR_RSS_SpeedCalculator.SampleSlope 填充）：法线与室内抑制每 tick 只取一次
+// 移动中且给了估计器时来自高度格（m_bFromHeightmap），m_vNormal 为按航向坡度合成的等效法线
+class SCR_RSS_SlopeSample
+{
+    bool m_bSuppressed;
+    float m_fMagnitudeDeg;
+    vector m_vNormal;
+    vector m_vFallbackVelocity;
+    bool m_bFromHeightmap;
+    // 估计器持有的本 tick 结果（限速预测坡度复用，不再二次估计）
+    SCR_RSS_GradeEstimate m_pGradeEstimate;
+}
+
 class SCR_RSS_SpeedCalculator
 {
     // ==================== 公共方法 ====================
@@ -483,20 +496,80 @@ class SCR_RSS_SpeedCalculator
     // @return 坡度角度幅值（0..45 度），失败返回 0
     static float GetTerrainSlopeAngleMagnitude(SCR_CharacterControllerComponent controller)
     {
+        SCR_RSS_SlopeSample sample = new SCR_RSS_SlopeSample();
+        SampleSlope(controller, null, sample);
+        return sample.m_fMagnitudeDeg;
+    }
+
+    // 法线 → 坡度幅值（0..45 度）
+    static float GetSlopeAngleMagnitudeFromNormal(vector normal)
+    {
+        float dotUp = vector.Dot(normal, vector.Up);
+        dotUp = Math.Clamp(dotUp, 0.0, 1.0);
+        float slopeAngleDegrees = Math.Acos(dotUp) * Math.RAD2DEG;
+        return Math.Clamp(slopeAngleDegrees, 0.0, 45.0);
+    }
+
+    // 单 tick 坡度采样：室内抑制判定 + 地面坡度各取一次
+    // 坡度来源：给了 gradeEstimator 且未抑制、水平速度 ≥ HEADING_SPEED_MIN_MS 时走高度格（沿航向坡度，
+    // 与限速预测坡度同一次估计）；否则（室内楼梯、静止、未给估计器）走 SCR_RSS_TerrainNormalCache 法线。
+    // 之后任意速度方向的有效坡度都由 GetRawSlopeAngleFromSample 纯数学投影，不再查地形
+    // @param environmentFactor 可选；为 null 时不做室内抑制
+    // @param gradeEstimator 可选；实体自己的坡度估计器（游泳、攀爬时调用方传 null）
+    // @param velocity 高度格路径的航向速度
+    // @param currentTimeSec 高度格路径的平滑时间戳
+    static void SampleSlope(SCR_CharacterControllerComponent controller, SCR_RSS_EnvironmentFactor environmentFactor, SCR_RSS_SlopeSample sample,
+        SCR_RSS_GradeEstimator gradeEstimator = null, vector velocity = vector.Zero, float currentTimeSec = 0.0)
+    {
+        sample.m_bSuppressed = false;
+        sample.m_fMagnitudeDeg = 0.0;
+        sample.m_vNormal = vector.Up;
+        sample.m_vFallbackVelocity = vector.Zero;
+        sample.m_bFromHeightmap = false;
+        sample.m_pGradeEstimate = null;
         if (!controller)
-            return 0.0;
+            return;
         IEntity owner = controller.GetOwner();
         if (!owner)
-            return 0.0;
+            return;
+        if (environmentFactor && environmentFactor.ShouldSuppressTerrainSlopeForEntity(owner))
+            sample.m_bSuppressed = true;
         BaseWorld world = owner.GetWorld();
         if (!world)
-            return 0.0;
-        vector pos = owner.GetOrigin();
-        vector normal = SCR_TerrainHelper.GetTerrainNormal(pos, world, false, null);
-        float dotUp = vector.Dot(normal, vector.Up);
-        dotUp = Math.Clamp(dotUp, 0.0, 1.0);
-        float slopeAngleDegrees = Math.Acos(dotUp) * Math.RAD2DEG;
-        return Math.Clamp(slopeAngleDegrees, 0.0, 45.0);
+            return;
+        if (gradeEstimator && !sample.m_bSuppressed && SampleSlopeFromHeightmap(owner, world, sample, gradeEstimator, velocity, currentTimeSec))
+            return;
+        sample.m_vNormal = SCR_RSS_TerrainNormalCache.GetNormal(owner.GetOrigin(), world);
+        sample.m_fMagnitudeDeg = GetSlopeAngleMagnitudeFromNormal(sample.m_vNormal);
+        sample.m_vFallbackVelocity = controller.GetVelocity();
+    }
+
+    // 高度格坡度 → 等效法线：上坡方向取航向（下坡取反），倾角 atan(|坡度|)，
+    // 使 GetSlopeProjectionCos / GetRawSlopeAngleFromSample 对同一速度方向原样得到沿航向坡度
+    // @return false 表示静止或估计器关闭，调用方回退法线
+    protected static bool SampleSlopeFromHeightmap(IEntity owner, BaseWorld world, SCR_RSS_SlopeSample sample,
+        SCR_RSS_GradeEstimator gradeEstimator, vector velocity, float currentTimeSec)
+    {
+        if (!SCR_RSS_GradeEstimator.ENABLED)
+            return false;
+        vector heading = velocity;
+        heading[1] = 0.0;
+        float speed = heading.Length();
+        if (speed < SCR_RSS_GradeEstimator.HEADING_SPEED_MIN_MS)
+            return false;
+        heading = heading * (1.0 / speed);
+
+        SCR_RSS_GradeEstimate est = gradeEstimator.Estimate(owner.GetOrigin(), velocity, currentTimeSec, world);
+        float gradeRatio = est.m_fRawGradePercent / 100.0;
+        if (gradeRatio < 0.0)
+            heading = heading * -1.0;
+        float angleRad = Math.Atan2(Math.AbsFloat(gradeRatio), 1.0);
+        sample.m_vNormal = vector.Up * Math.Cos(angleRad) - heading * Math.Sin(angleRad);
+        sample.m_fMagnitudeDeg = Math.Clamp(angleRad * Math.RAD2DEG, 0.0, 45.0);
+        sample.m_vFallbackVelocity = velocity;
+        sample.m_bFromHeightmap = true;
+        sample.m_pGradeEstimate = est;
+        return true;
     }
 
     // 根据速度矢量与坡向得到“沿运动方向”的投影系数 cos(速度与上坡夹角)
@@ -540,77 +613,70 @@ class SCR_RSS_SpeedCalculator
     // 获取原始坡度角度（不做室内归零，供室内楼梯判定等使用）
     // 使用“运动方向有效坡度”：幅值由地形法线得到，再投影到速度方向（magnitude × cos(速度与上坡夹角)），
     // 使沿等高线移动时坡度为 0、斜向移动时坡度按几何比例缩放，与 Pandolf 的“沿路径坡度”一致，避免法线全幅导致的不合理。
-    // @param controller 角色控制器组件
-    // @param velocity 速度矢量（可选，vector.Zero 时从 controller 获取；静止时有效坡度=0）
+    // @param sample 本 tick 的 SampleSlope 结果
+    // @param velocity 速度矢量（静止时退回采样时的 controller 速度；仍静止则有效坡度=0）
     // @return 有效坡度角度（度），正=上坡，负=下坡，0=平地/等高线/静止
-    static float GetRawSlopeAngle(SCR_CharacterControllerComponent controller, vector velocity = vector.Zero)
+    static float GetRawSlopeAngleFromSample(SCR_RSS_SlopeSample sample, vector velocity)
     {
-        if (!controller)
-            return 0.0;
-        IEntity owner = controller.GetOwner();
-        if (!owner)
-            return 0.0;
-        float magnitude = GetTerrainSlopeAngleMagnitude(controller);
-        if (magnitude < 0.01)
+        if (!sample || sample.m_fMagnitudeDeg < 0.01)
             return 0.0;
-        vector pos = owner.GetOrigin();
-        vector normal = SCR_TerrainHelper.GetTerrainNormal(pos, owner.GetWorld(), false, null);
         if (velocity.Length() < VELOCITY_SIGN_THRESHOLD)
-            velocity = controller.GetVelocity();
-        float cosAngle = GetSlopeProjectionCos(normal, velocity);
-        float effectiveSlopeDegrees = magnitude * cosAngle;
+            velocity = sample.m_vFallbackVelocity;
+        float cosAngle = GetSlopeProjectionCos(sample.m_vNormal, velocity);
+        float effectiveSlopeDegrees = sample.m_fMagnitudeDeg * cosAngle;
         return Math.Clamp(effectiveSlopeDegrees, -45.0, 45.0);
     }
+
+    // 同 GetRawSlopeAngleFromSample，但室内（抑制）时归零
+    static float GetSlopeAngleFromSample(SCR_RSS_SlopeSample sample, vector velocity)
+    {
+        if (!sample || sample.m_bSuppressed)
+            return 0.0;
+        return GetRawSlopeAngleFromSample(sample, velocity);
+    }
+
+    // 单次查询版本（非 tick 路径，如 RPC 校验）；tick 内请先 SampleSlope 再用 *FromSample
+    static float GetRawSlopeAngle(SCR_CharacterControllerComponent controller, vector velocity = vector.Zero)
+    {
+        SCR_RSS_SlopeSample sample = new SCR_RSS_SlopeSample();
+        SampleSlope(controller, null, sample);
+        return GetRawSlopeAngleFromSample(sample, velocity);
+    }
     
-    // 获取坡度角度（完全用法线坡度 + 速度矢量判断上下坡）
-    // 此方法直接返回坡度角度，单位为度。
+    // 获取坡度角度（完全用法线坡度 + 速度矢量判断上下坡）；单次查询版本
     // @param controller 角色控制器组件
     // @param environmentFactor 环境因子组件（可选，用于室内检测)
     // @param velocity 速度矢量（可选，用于判断上下坡）
     // @return 坡度角度（度）
     static float GetSlopeAngle(SCR_CharacterControllerComponent controller, SCR_RSS_EnvironmentFactor environmentFactor = null, vector velocity = vector.Zero)
     {
-        if (environmentFactor && controller)
-        {
-            IEntity ownerForCheck = controller.GetOwner();
-            if (ownerForCheck && environmentFactor.ShouldSuppressTerrainSlopeForEntity(ownerForCheck))
-                return 0.0;
-        }
-        return GetRawSlopeAngle(controller, velocity);
+        SCR_RSS_SlopeSample sample = new SCR_RSS_SlopeSample();
+        SampleSlope(controller, environmentFactor, sample);
+        return GetSlopeAngleFromSample(sample, velocity);
     }
     
     // 计算坡度百分比（考虑攀爬和跳跃状态）
     // 返回值中的 gradePercent 为坡度的百分比（rise/run × 100）。
-    // 注意：原始角度由 GetSlopeAngle 返回（度），需要通过 tan() 转换。
     // @param controller 角色控制器组件
     // @param currentSpeed 当前速度（m/s）
     // @param jumpVaultDetector 跳跃检测器（可选）
-    // @param slopeAngleDegrees 坡度角度（输入，通常为0.0；输出会被替换）
-    // @param environmentFactor 环境因子组件（可选，用于室内检测）
-    // @param velocity 速度矢量（可选，用于判断上下坡，游泳时传 computedVelocity）
+    // @param sample 本 tick 的 SampleSlope 结果（室内抑制已含在内）
+    // @param velocity 速度矢量（用于判断上下坡，游泳时传 computedVelocity）
     // @return 坡度计算结果（包含坡度百分比和角度）
-    static GradeCalculationResult CalculateGradePercent(
+    static GradeCalculationResult CalculateGradePercentFromSample(
         SCR_CharacterControllerComponent controller,
         float currentSpeed,
         SCR_RSS_JumpVaultDetector jumpVaultDetector,
-        float slopeAngleDegrees,
-        SCR_RSS_EnvironmentFactor environmentFactor = null,
-        vector velocity = vector.Zero)
+        SCR_RSS_SlopeSample sample,
+        vector velocity)
     {
         GradeCalculationResult result = new GradeCalculationResult();
         result.gradePercent = 0.0;
-        result.slopeAngleDegrees = slopeAngleDegrees;
+        result.slopeAngleDegrees = 0.0;
         
-        // 完整室内或建筑物内有顶体积：返回零坡度（与 GetSlopeAngle 一致）
-        if (environmentFactor && controller)
-        {
-            IEntity ownerForCheck = controller.GetOwner();
-            if (ownerForCheck && environmentFactor.ShouldSuppressTerrainSlopeForEntity(ownerForCheck))
-            {
-                result.slopeAngleDegrees = 0.0;
-                return result;
-            }
-        }
+        // 完整室内或建筑物内有顶体积：返回零坡度
+        if (!controller || !sample || sample.m_bSuppressed)
+            return result;
         
         // 检查是否在攀爬或跳跃状态
         bool isClimbingForSlope = controller.IsClimbing();
@@ -621,8 +687,7 @@ class SCR_RSS_SpeedCalculator
         // 只在非攀爬、非跳跃状态下获取坡度
         if (!isClimbingForSlope && !isJumpingForSlope && currentSpeed > 0.05)
         {
-            // 获取坡度角度并转换为坡度百分比（传入 velocity 用于判断上下坡）
-            float rawAngleDeg = GetSlopeAngle(controller, environmentFactor, velocity);
+            float rawAngleDeg = GetRawSlopeAngleFromSample(sample, velocity);
             result.slopeAngleDegrees = rawAngleDeg;
             // 将角度转换为斜率比：tan(angle_rad)
             float slopeRatio = Math.Tan(rawAngleDeg * Math.DEG2RAD);
@@ -0,0 +1,242 @@
+//! v6 功率→速度反解查表：InvertSpeedForPowerWatts 的按上下文缓存版本
+//!
+//! 每个量化上下文（总重 0.5 kg × 坡度 0.5% × 地形 0.05 × 步态）建一张 33 点正向功率表，
+//! 速度步长 = V6_INVERT_SPEED_MAX_MS / 32，恰为 24 步二分前 5 个中点，故 5 级下降与二分走同一分支
+//! （低速 Pandolf 驼峰、Walk LCDA→Pandolf 切换等非单调处亦然）。
+//! 查询：5 级下降 + 单元内线性插值 + 一次以精确功率、表内斜率做的牛顿修正（修正步出单元时再做一次弦截）。
+//! CP 变化（疲劳/环境/负重）只换目标功率，不需要重建。
+//! 建表约 65 次正向求值，而一次 24 步二分只要 24 次：上下文首次出现时直接二分（只记下 key），
+//! 同一上下文第二次出现才建表；表缓存满时淘汰最久未用的一张。配置纪元或负重代谢阻尼变化时整体重建。
+//!
+//! 守护单元：单元 0（v<0.1 静态分支）、Walk 跨 LCDA 切换点、中点偏离线性超过 1% 的单元，
+//! 在至多三格内按二分求解（相邻节点仍保持括号时才外扩），分辨率与精确反解相同。
+//! 与 tools/rss_sim/src/speed_inverse.rs 逐项一致，对照：cargo run --bin speed_inverse_verify
+
+class SCR_RSS_SpeedInverseTable
+{
+    static const int DESCENT_LEVELS = 5;
+    static const int FORWARD_NODES = 33;
+    static const int GUARDED_BISECTION_LEVELS = 21;
+
+    static const float WEIGHT_QUANT_KG = 0.5;
+    static const float GRADE_QUANT_PCT = 0.5;
+    static const float TERRAIN_QUANT = 0.05;
+
+    //! 表缓存上限：满时淘汰最久未用的一张
+    static const int MAX_CACHED_TABLES = 256;
+    //! 只见过一次的上下文 key 上限：满时清空（仅是计数，丢掉只会让下次命中多走一次二分）
+    static const int MAX_PENDING_KEYS = 1024;
+
+    protected static ref map<int, ref SCR_RSS_SpeedInverseTable> s_mTables;
+    protected static ref map<int, bool> s_mSeenOnceKeys;
+    protected static float s_fDampeningKey = -1.0;
+    protected static int s_iConfigEpoch = -1;
+    protected static int s_iUseCounter;
+
+    protected ref array<float> m_aForward;
+    protected ref array<bool> m_aCellExact;
+    protected int m_iLastUse;
+
+    //------------------------------------------------------------------------------------------------
+    //! 与 InvertSpeedForPowerWatts 语义相同（目标功率 ≤1 W 返回 0，上限 V6_INVERT_SPEED_MAX_MS）
+    static float Lookup(
+        float targetPowerWatts,
+        float totalWeightKg,
+        float gradePercent,
+        float terrainFactor,
+        int movementPhase)
+    {
+        if (targetPowerWatts <= 1.0)
+            return 0.0;
+
+        SCR_RSS_SpeedInverseTable table = GetTable(totalWeightKg, gradePercent, terrainFactor, movementPhase);
+        if (!table)
+        {
+            return SCR_RSS_MetabolismModel.InvertSpeedForPowerWattsExact(
+                targetPowerWatts, totalWeightKg, gradePercent, terrainFactor, movementPhase);
+        }
+        return table.Solve(targetPowerWatts, totalWeightKg, gradePercent, terrainFactor, movementPhase);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 上下文首次出现返回 null（调用方直接二分），第二次出现时建表
+    protected static SCR_RSS_SpeedInverseTable GetTable(float totalWeightKg, float gradePercent, float terrainFactor, int movementPhase)
+    {
+        float dampening = SCR_RSS_ConfigBridge.GetLoadMetabolicDampening();
+        int epoch = SCR_RSS_ConfigManager.GetConfigEpoch();
+        if (!s_mTables || dampening != s_fDampeningKey || epoch != s_iConfigEpoch)
+        {
+            s_fDampeningKey = dampening;
+            s_iConfigEpoch = epoch;
+            s_mTables = new map<int, ref SCR_RSS_SpeedInverseTable>();
+            s_mSeenOnceKeys = new map<int, bool>();
+        }
+
+        int wq = Math.Clamp(Math.Round(totalWeightKg / WEIGHT_QUANT_KG), 0, 1023);
+        int gq = Math.Clamp(Math.Round(gradePercent / GRADE_QUANT_PCT), -256, 255);
+        int tq = Math.Clamp(Math.Round(terrainFactor / TERRAIN_QUANT), 0, 127);
+        int phase = Math.ClampInt(movementPhase, 0, 3);
+        int key = ((phase * 1024 + wq) * 512 + (gq + 256)) * 128 + tq;
+
+        s_iUseCounter++;
+        SCR_RSS_SpeedInverseTable table;
+        if (s_mTables.Find(key, table))
+        {
+            table.m_iLastUse = s_iUseCounter;
+            return table;
+        }
+
+        if (!s_mSeenOnceKeys.Contains(key))
+        {
+            if (s_mSeenOnceKeys.Count() >= MAX_PENDING_KEYS)
+                s_mSeenOnceKeys.Clear();
+            s_mSeenOnceKeys.Insert(key, true);
+            return null;
+        }
+        s_mSeenOnceKeys.Remove(key);
+
+        if (s_mTables.Count() >= MAX_CACHED_TABLES)
+            EvictLeastRecentlyUsed();
+
+        table = new SCR_RSS_SpeedInverseTable();
+        table.Build(wq * WEIGHT_QUANT_KG, gq * GRADE_QUANT_PCT, tq * TERRAIN_QUANT, movementPhase);
+        table.m_iLastUse = s_iUseCounter;
+        s_mTables.Insert(key, table);
+        return table;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 线性扫描淘汰一张；只在建表时发生（建表本身 65 次求值，扫描 256 项可忽略）
+    protected static void EvictLeastRecentlyUsed()
+    {
+        int oldestKey;
+        int oldestUse;
+        bool found = false;
+        foreach (int key, SCR_RSS_SpeedInverseTable table : s_mTables)
+        {
+            if (!found || table.m_iLastUse < oldestUse)
+            {
+                found = true;
+                oldestUse = table.m_iLastUse;
+                oldestKey = key;
+            }
+        }
+        s_mTables.Remove(oldestKey);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float StepMs()
+    {
+        return SCR_RSS_Constants.V6_INVERT_SPEED_MAX_MS / (FORWARD_NODES - 1);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void Build(float totalWeightKg, float gradePercent, float terrainFactor, int movementPhase)
+    {
+        float step = StepMs();
+        m_aForward = new array<float>();
+        m_aForward.Resize(FORWARD_NODES);
+        for (int i = 0; i < FORWARD_NODES; i++)
+        {
+            m_aForward[i] = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+                i * step, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        }
+
+        m_aCellExact = new array<bool>();
+        m_aCellExact.Resize(FORWARD_NODES - 1);
+        for (int c = 0; c < FORWARD_NODES - 1; c++)
+        {
+            float pMid = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+                (c + 0.5) * step, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+            m_aCellExact[c] = CellNeedsExact(c, movementPhase, m_aForward[c], m_aForward[c + 1], pMid);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 单次牛顿修正不够准的单元改走二分
+    protected static bool CellNeedsExact(int cell, int movementPhase, float pLo, float pHi, float pMid)
+    {
+        if (cell == 0)
+            return true;
+
+        float vLo = cell * StepMs();
+        if ((movementPhase == 0 || movementPhase == 1)
+            && vLo <= SCR_RSS_Constants.LCDA_MAX_SPEED_MS
+            && SCR_RSS_Constants.LCDA_MAX_SPEED_MS <= vLo + StepMs())
+            return true;
+
+        float linear = 0.5 * (pLo + pHi);
+        return Math.AbsFloat(pMid - linear) > Math.Max(0.01 * Math.AbsFloat(pMid), 2.0);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected float Solve(float targetPowerWatts, float totalWeightKg, float gradePercent, float terrainFactor, int movementPhase)
+    {
+        int lo = 0;
+        int hi = FORWARD_NODES - 1;
+        for (int level = 0; level < DESCENT_LEVELS; level++)
+        {
+            int mid = (lo + hi) / 2;
+            if (m_aForward[mid] > targetPowerWatts)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        float step = StepMs();
+        float vMax = SCR_RSS_Constants.V6_INVERT_SPEED_MAX_MS;
+        float vLo = lo * step;
+        float vHi = hi * step;
+
+        if (m_aCellExact[lo])
+        {
+            // 量化可能把交点推过节点：括号向外扩一格，但仅当相邻节点仍保持括号
+            // （左侧功率 ≤ 目标、右侧 > 目标）；非单调段上盲扩会框进另一个交点
+            float a = vLo;
+            if (lo > 0 && m_aForward[lo - 1] <= targetPowerWatts)
+                a = vLo - step;
+            float b = vHi;
+            if (hi < FORWARD_NODES - 1 && m_aForward[hi + 1] > targetPowerWatts)
+                b = vHi + step;
+            for (int i = 0; i < GUARDED_BISECTION_LEVELS; i++)
+            {
+                float vMid = (a + b) * 0.5;
+                float pMid = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+                    vMid, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+                if (pMid > targetPowerWatts)
+                    b = vMid;
+                else
+                    a = vMid;
+            }
+            return (a + b) * 0.5;
+        }
+
+        float pLo = m_aForward[lo];
+        float pHi = m_aForward[hi];
+        float frac = 0.5;
+        if (Math.AbsFloat(pHi - pLo) > 0.000001)
+            frac = Math.Clamp((targetPowerWatts - pLo) / (pHi - pLo), 0.0, 1.0);
+        float vEst = vLo + (vHi - vLo) * frac;
+
+        // 以精确功率 + 表内斜率做一次牛顿修正（斜率对量化偏移不敏感）
+        float p = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+            vEst, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        float slope = (pHi - pLo) / step;
+        if (slope <= 0.000001)
+            return vEst;
+
+        float v = vEst + (targetPowerWatts - p) / slope;
+        v = Math.Clamp(v, vLo - step, vHi + step);
+        v = Math.Clamp(v, 0.0, vMax);
+        if (v >= vLo && v <= vHi)
+            return v;
+
+        // 修正步出了单元：单元斜率对落点处（折点/更陡的邻格）不可靠，
+        // 两个精确采样夹住目标时再做一次弦截
+        float pOut = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+            v, totalWeightKg, gradePercent, terrainFactor, true, movementPhase);
+        if ((p - targetPowerWatts) * (pOut - targetPowerWatts) < 0.0)
+            return vEst + (targetPowerWatts - p) * (v - vEst) / (pOut - p);
+        return v;
+    }
+}
@@ -0,0 +1,169 @@
+//! RSS 速度输出暂存（每实体）
+//! 一次体力 tick 内 Phase A（跛行/CP 巡航/AI）、Phase B 代谢修正、Phase C W′ 纠偏与 AI 状态机
+//! 都可能写限速或钳物理速度。各处只暂存：限速倍率后写者覆盖，水平速度钳取最严；
+//! tick 末 Commit 一次落盘。倍率与上次实际写入相差不足 LIMIT_EPSILON 时跳过引擎调用。
+
+class SCR_RSS_SpeedOutputStage
+{
+    //! 与上次写入的倍率差小于此值视为相同（SetSpeedLimit 分母为相位顶速，0.0005 ≈ 3 mm/s）
+    //! 须小于 FractionForAbsoluteSpeed 的 0.999 保源值与 1.0 之差
+    static const float LIMIT_EPSILON = 0.0005;
+    //! 去重记忆的有效期：超过即重写一次，防止引擎侧限速图被外部清掉后长期不同步
+    static const float LIMIT_REFRESH_SEC = 1.0;
+    //! 钳目标（m/s）差小于此值视为相同
+    static const float CLAMP_EPSILON_MS = 0.01;
+
+    protected bool m_bHasPendingLimit = false;
+    protected float m_fPendingLimit = 1.0;
+    protected float m_fPendingHardClampMs = -1.0;
+    protected float m_fPendingSoftClampMs = -1.0;
+    protected float m_fPendingSoftClampDtSec = 0.05;
+
+    protected float m_fWrittenLimit = -1.0;
+    protected float m_fWrittenAtSec = -1.0;
+    protected float m_fClampedMs = -1.0;
+    protected float m_fClampedAtSec = -1.0;
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 开始：丢弃未提交的暂存
+    void Begin()
+    {
+        m_bHasPendingLimit = false;
+        m_fPendingHardClampMs = -1.0;
+        m_fPendingSoftClampMs = -1.0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 暂存限速倍率（语义同 SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit；同 tick 内后写者覆盖）
+    void StageLimit(float limit)
+    {
+        m_fPendingLimit = limit;
+        m_bHasPendingLimit = true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 暂存硬钳（目标见 SCR_RSS_SpeedBridge.HardClampTargetMs；调用方负责全局开关判定）
+    void StageHardClamp(float maxHorizMs)
+    {
+        if (maxHorizMs < 0.1)
+            return;
+        if (m_fPendingHardClampMs < 0.0 || maxHorizMs < m_fPendingHardClampMs)
+            m_fPendingHardClampMs = maxHorizMs;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 暂存软钳（目标见 SCR_RSS_SpeedBridge.SoftClampTargetMs）
+    void StageSoftClamp(float maxHorizMs, float dtSec)
+    {
+        if (maxHorizMs < 0.1)
+            return;
+        if (m_fPendingSoftClampMs < 0.0 || maxHorizMs < m_fPendingSoftClampMs)
+        {
+            m_fPendingSoftClampMs = maxHorizMs;
+            m_fPendingSoftClampDtSec = dtSec;
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 末落盘：限速至多一次 SetSpeedLimit，速度钳至多一次 Get/SetVelocity
+    void Commit(IEntity owner, float worldTimeSec)
+    {
+        if (!owner)
+        {
+            Begin();
+            return;
+        }
+
+        if (m_bHasPendingLimit)
+            WriteLimit(owner, m_fPendingLimit, worldTimeSec);
+
+        if (m_fPendingHardClampMs > 0.0 || m_fPendingSoftClampMs > 0.0)
+        {
+            CommitClamp(owner);
+            m_fClampedMs = m_fPendingHardClampMs;
+            m_fClampedAtSec = worldTimeSec;
+        }
+
+        Begin();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 外的直接写入（OnPrepareControls 重申等）：同样去重，并更新记忆
+    void WriteLimit(IEntity owner, float limit, float worldTimeSec)
+    {
+        limit = Math.Clamp(limit, 0.01, 3.0);
+        // 1.0 会移除限速源，跨越该边界的写入永不去重
+        if (m_fWrittenLimit >= 0.0
+            && (limit >= 1.0) == (m_fWrittenLimit >= 1.0)
+            && Math.AbsFloat(limit - m_fWrittenLimit) < LIMIT_EPSILON
+            && worldTimeSec - m_fWrittenAtSec < LIMIT_REFRESH_SEC
+            && worldTimeSec >= m_fWrittenAtSec)
+            return;
+
+        SCR_RSS_SpeedBridge.ApplyStaminaSpeedLimit(owner, limit);
+        m_fWrittenLimit = limit;
+        m_fWrittenAtSec = worldTimeSec;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 外的硬钳（OnPrepareControls 重申）：目标与上次落盘相同且仍在 LIMIT_REFRESH_SEC 内则跳过，
+    //! 否则经暂存提交一次 Get/SetVelocity。调用方负责全局开关判定。
+    void WriteHardClamp(IEntity owner, float maxHorizMs, float worldTimeSec)
+    {
+        if (!owner || maxHorizMs < 0.1)
+            return;
+        if (m_fClampedMs > 0.0
+            && Math.AbsFloat(maxHorizMs - m_fClampedMs) < CLAMP_EPSILON_MS
+            && worldTimeSec - m_fClampedAtSec < LIMIT_REFRESH_SEC
+            && worldTimeSec >= m_fClampedAtSec)
+            return;
+
+        float savedHard = m_fPendingHardClampMs;
+        float savedSoft = m_fPendingSoftClampMs;
+        m_fPendingHardClampMs = maxHorizMs;
+        m_fPendingSoftClampMs = -1.0;
+        CommitClamp(owner);
+        m_fPendingHardClampMs = savedHard;
+        m_fPendingSoftClampMs = savedSoft;
+
+        m_fClampedMs = maxHorizMs;
+        m_fClampedAtSec = worldTimeSec;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 绕过本暂存的写入（清源、标定等）后调用：下一次提交必写
+    void Invalidate()
+    {
+        m_fWrittenLimit = -1.0;
+        m_fWrittenAtSec = -1.0;
+        m_fClampedMs = -1.0;
+        m_fClampedAtSec = -1.0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void CommitClamp(IEntity owner)
+    {
+        Physics physics = owner.GetPhysics();
+        if (!physics)
+            return;
+
+        vector velocity = physics.GetVelocity();
+        float horizSq = velocity[0] * velocity[0] + velocity[2] * velocity[2];
+        if (horizSq <= 0.0001)
+            return;
+
+        float speed = Math.Sqrt(horizSq);
+        float target = speed;
+        if (m_fPendingHardClampMs > 0.0)
+            target = SCR_RSS_SpeedBridge.HardClampTargetMs(target, m_fPendingHardClampMs);
+        if (m_fPendingSoftClampMs > 0.0)
+            target = SCR_RSS_SpeedBridge.SoftClampTargetMs(target, m_fPendingSoftClampMs, m_fPendingSoftClampDtSec);
+        if (target >= speed)
+            return;
+
+        float scale = target / speed;
+        velocity[0] = velocity[0] * scale;
+        velocity[2] = velocity[2] * scale;
+        physics.SetVelocity(velocity);
+    }
+}
@@ -148,8 +148,25 @@ class SCR_RSS_StaminaNetRate
         return movementDrainRate + epocDrainRate;
     }
 
-    static StaminaEtaResult ComputeStaminaEta(
+    //! 写入单 tick 速率记录（rates 为 null 时忽略）
+    static void PublishTickRates(
+        StaminaTickRates rates,
         float staminaPercent,
+        float recoveryPerTick,
+        float finalDrainPerTick)
+    {
+        if (!rates)
+            return;
+        rates.valid = true;
+        rates.staminaPercent = staminaPercent;
+        rates.recoveryPerTick = recoveryPerTick;
+        rates.finalDrainPerTick = finalDrainPerTick;
+        rates.netPerSec = (recoveryPerTick - finalDrainPerTick) * 5.0;
+    }
+
+    //! 由本 tick 已发布的速率推 ETA（只有静止回满的分段积分仍需恢复曲线）
+    static StaminaEtaResult ComputeStaminaEtaFromRates(
+        StaminaTickRates rates,
         float targetStaminaCap,
         bool useSwimmingModel,
         float currentSpeed,
@@ -168,26 +185,12 @@ class SCR_RSS_StaminaNetRate
         StaminaEtaResult result = new StaminaEtaResult();
         result.timeToDepleteSec = -1.0;
         result.timeToFullSec = -1.0;
+        if (!rates || !rates.valid)
+            return result;
 
-        float recoveryPerSec = ComputeRecoveryRatePerTick(
-            staminaPercent,
-            currentSpeed,
-            baseDrainRateByVelocity,
-            baseDrainRateByVelocityForModule,
-            heatStressMultiplier,
-            epocState,
-            encumbranceCache,
-            exerciseTracker,
-            controller,
-            environmentFactor,
-            false) * 5.0;
-
-        float drainPerSec = ComputeFinalDrainRatePerTick(
-            useSwimmingModel,
-            currentSpeed,
-            totalDrainRate,
-            epocState,
-            false) * 5.0;
+        float staminaPercent = rates.staminaPercent;
+        float recoveryPerSec = rates.recoveryPerTick * 5.0;
+        float drainPerSec = rates.finalDrainPerTick * 5.0;
         if (overspeedExtraDrainPerSec > 0.0)
             drainPerSec = drainPerSec + overspeedExtraDrainPerSec;
 
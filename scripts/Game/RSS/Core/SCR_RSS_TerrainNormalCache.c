@@ -0,0 +1,50 @@
+//! 地面法线世界缓存：按 CELL_SIZE_M 网格共享，同格实体（扎堆 AI、同一玩家相邻 tick）只查一次地形
+//!
+//! 地形在一局内不变，格子取格心法线，同格实体得到完全相同的坡度；世界切换时整表丢弃。
+//! 表满（MAX_CELLS）整表清空重建，不做 LRU——长距离行军的命中主要来自最近几个格子。
+//! ENABLED=false 时直接按实体坐标查询（与缓存前逐实体查询一致）。
+
+class SCR_RSS_TerrainNormalCache
+{
+    static const bool ENABLED = true;
+    //! 格边长（m）；与地形高度图分辨率同量级，格内法线差异远小于坡度平滑的时间尺度
+    static const float CELL_SIZE_M = 2.0;
+    static const int MAX_CELLS = 8192;
+    //! 格坐标各取 15 位拼键（2 m 格覆盖 65 km；超出后回绕撞键，现有地图远小于此）
+    protected static const int CELL_KEY_SPAN = 32768;
+    protected static const int CELL_KEY_MASK = 32767;
+
+    protected static BaseWorld s_pWorld;
+    protected static ref map<int, vector> s_mNormalByCell;
+
+    //------------------------------------------------------------------------------------------------
+    static vector GetNormal(vector pos, BaseWorld world)
+    {
+        if (!ENABLED || !world)
+            return SCR_TerrainHelper.GetTerrainNormal(pos, world, false, null);
+
+        if (!s_mNormalByCell || s_pWorld != world)
+        {
+            s_mNormalByCell = new map<int, vector>();
+            s_pWorld = world;
+        }
+
+        int cellX = Math.Floor(pos[0] / CELL_SIZE_M);
+        int cellZ = Math.Floor(pos[2] / CELL_SIZE_M);
+        int key = (cellX & CELL_KEY_MASK) * CELL_KEY_SPAN + (cellZ & CELL_KEY_MASK);
+
+        vector normal;
+        if (s_mNormalByCell.Find(key, normal))
+            return normal;
+
+        vector center = pos;
+        center[0] = (cellX + 0.5) * CELL_SIZE_M;
+        center[2] = (cellZ + 0.5) * CELL_SIZE_M;
+        normal = SCR_TerrainHelper.GetTerrainNormal(center, world, false, null);
+
+        if (s_mNormalByCell.Count() >= MAX_CELLS)
+            s_mNormalByCell.Clear();
+        s_mNormalByCell.Insert(key, normal);
+        return normal;
+    }
+}
@@ -0,0 +1,89 @@
+//! 体力 tick 节拍：实测步长 + 玩家静止降频
+//!
+//! 每 tick 开始记录距上一 tick 的真实间隔（AI LOD、降频、插队 tick 都会让它偏离调度间隔），
+//! 位置差分测速与体力积分都用它。
+//! 玩家全速（17 ms）运行；静止（速度≈0、相位 0、无冲刺意图、不游泳）且相位/姿态 IDLE_STABLE_SEC 内未变，
+//! 才降到 IDLE_INTERVAL_MS。降频回调带代号：输入到来时 Promote 换代号并立即插一次 tick，
+//! 挂起的慢回调到期后因代号过期直接丢弃，不会出现两条 tick 链。
+
+class SCR_RSS_TickScheduler
+{
+    //! 静止降频间隔（8 Hz）
+    static const int IDLE_INTERVAL_MS = 125;
+    //! 静止持续多久才降频
+    static const float IDLE_STABLE_SEC = 1.0;
+    //! 低于此水平速度视为静止（m/s）
+    static const float IDLE_SPEED_MS = 0.05;
+    //! 单步上限：超过视为卡顿/暂停（载具 1 s、AI 远 LOD 1.5 s 均在内）
+    static const float MAX_STEP_SEC = 2.0;
+
+    protected float m_fLastTickSec = -1.0;
+    protected float m_fElapsedSec = 0.0;
+    protected float m_fIdleSinceSec = -1.0;
+    protected int m_iLastPhase = -1;
+    protected int m_iLastStance = -1;
+    protected bool m_bIdleRate = false;
+    protected int m_iGeneration = 0;
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 开始：记录真实间隔；首 tick 或时间回退时用调度间隔兜底
+    //! 同时清除降频标记——本 tick 若走早退/载具路径，挂起的就不再是带代号的慢回调
+    float BeginTick(float nowSec, float fallbackSec)
+    {
+        float elapsed = fallbackSec;
+        if (m_fLastTickSec >= 0.0 && nowSec > m_fLastTickSec)
+            elapsed = nowSec - m_fLastTickSec;
+        m_fLastTickSec = nowSec;
+        m_fElapsedSec = Math.Clamp(elapsed, 0.001, MAX_STEP_SEC);
+        m_bIdleRate = false;
+        return m_fElapsedSec;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float GetElapsedSec()
+    {
+        return m_fElapsedSec;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 末：决定下一次间隔。quiescent=false 或相位/姿态变化即重新计时并保持全速
+    int ResolveIntervalMs(int fullRateMs, bool quiescent, int movementPhase, int stance, float nowSec)
+    {
+        if (!quiescent || movementPhase != m_iLastPhase || stance != m_iLastStance)
+            m_fIdleSinceSec = -1.0;
+        else if (m_fIdleSinceSec < 0.0)
+            m_fIdleSinceSec = nowSec;
+        m_iLastPhase = movementPhase;
+        m_iLastStance = stance;
+
+        m_bIdleRate = m_fIdleSinceSec >= 0.0 && (nowSec - m_fIdleSinceSec) >= IDLE_STABLE_SEC;
+        if (m_bIdleRate)
+            return Math.Max(fullRateMs, IDLE_INTERVAL_MS);
+        return fullRateMs;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 挂起的是否为降频回调（仅此时才需要插队）
+    bool IsIdleRate()
+    {
+        return m_bIdleRate;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    int GetGeneration()
+    {
+        return m_iGeneration;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 输入到来：重置静止计时；若处于降频则作废挂起的慢回调，返回 true 由调用方立即补一次 tick
+    bool Promote()
+    {
+        m_fIdleSinceSec = -1.0;
+        if (!m_bIdleRate)
+            return false;
+        m_bIdleRate = false;
+        m_iGeneration++;
+        return true;
+    }
+}
@@ -3,6 +3,9 @@
 
 class SCR_RSS_UpdateCoordinator
 {
+    //! UpdateStaminaValue 单段积分上限（×0.2s，即 0.4s；旧版整步截断于此）
+    static const float MAX_TICK_SCALE_PER_SEGMENT = 2.0;
+
     // ── 结果对象（每次调用新分配，消除静态共享竞态）──
     // 高密度 AI 并行调用时静态共享对象会导致数据覆盖。
     // 修复：移除 s_pResultSpeedCalc / s_pResultBaseDrainRate，
@@ -17,6 +20,7 @@ class SCR_RSS_UpdateCoordinator
     // @param terrainFactor 地形系数（已包含泥泞修正）
     // @param windDrag 风阻系数
     // @param coldStaticPenalty 冷应激静态惩罚
+    // @param metabolicContext 本 tick 代谢上下文（可选；与 W′/EPOC 共用同入参的功率求值）
     // @return 基础消耗率（每0.2秒）
     static float CalculateLandBaseDrainRate(
         float currentSpeed,
@@ -29,7 +33,8 @@ class SCR_RSS_UpdateCoordinator
         int currentMovementPhase = -1,
         float encumbranceSpeedPenalty = 0.0,
         float effectiveCriticalPowerWatts = -1.0,
-        float wPrimePool01 = 1.0)
+        float wPrimePool01 = 1.0,
+        SCR_RSS_MetabolicTickContext metabolicContext = null)
     {
         float idleThreshold = SCR_RSS_Constants.RSS_IDLE_SPEED_THRESHOLD_MPS;
 
@@ -64,12 +69,12 @@ class SCR_RSS_UpdateCoordinator
             return staticPerS * SCR_RSS_Constants.RSS_STAMINA_TICK_SEC;
         }
 
-        float powerW = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+        float powerW = SCR_RSS_DrainCalculator.EvalPowerWatts(
+            metabolicContext,
             speedForPowerMs,
             currentWeightWithWet,
             gradePercent,
             terrainFactor,
-            true,
             phase);
         float pandolfPerS = SCR_RSS_MetabolismModel.StaminaDrainRatePerSecondFromPowerWatts(
             powerW, effectiveCriticalPowerWatts);
@@ -161,18 +166,22 @@ class SCR_RSS_UpdateCoordinator
         SCR_RSS_SlopeSpeedTransition slopeSpeedTransition = null,
         vector velocity = vector.Zero,
         float terrainFactor = 1.0,
-        int effectiveMovementPhase = -1)
+        int effectiveMovementPhase = -1,
+        SCR_RSS_SlopeSample slopeSample = null)
     {
         if (!controller)
             return 1.0;
         
-        IEntity ownerForStairs = controller.GetOwner();
-        bool shouldSuppressSlope = false;
-        if (environmentFactor && ownerForStairs)
-            shouldSuppressSlope = environmentFactor.ShouldSuppressTerrainSlopeForEntity(ownerForStairs);
+        // 本 tick 的坡度采样（调用方已采则复用，法线与室内判定不再重复查询）
+        if (!slopeSample)
+        {
+            slopeSample = new SCR_RSS_SlopeSample();
+            SCR_RSS_SpeedCalculator.SampleSlope(controller, environmentFactor, slopeSample);
+        }
+        bool shouldSuppressSlope = slopeSample.m_bSuppressed;
 
         // 室内楼梯：有顶建筑物内且原始坡度>0 时减轻负重对速度的惩罚（与 shouldSuppressSlope 范围一致）
-        float rawSlopeAngle = SCR_RSS_SpeedCalculator.GetRawSlopeAngle(controller, velocity);
+        float rawSlopeAngle = SCR_RSS_SpeedCalculator.GetRawSlopeAngleFromSample(slopeSample, velocity);
         bool isIndoorStairs = (shouldSuppressSlope && Math.AbsFloat(rawSlopeAngle) > 0.0);
         if (isIndoorStairs)
             encumbranceSpeedPenalty = encumbranceSpeedPenalty * SCR_RSS_Constants.GetIndoorStairsEncumbranceSpeedFactor();
@@ -203,7 +212,7 @@ class SCR_RSS_UpdateCoordinator
         // 室内（含楼梯间宽松判定）时硬归零，避免任何坡度速度惩罚
         float slopeAngleDegrees = 0.0;
         if (!shouldSuppressSlope)
-            slopeAngleDegrees = SCR_RSS_SpeedCalculator.GetSlopeAngle(controller, environmentFactor, velocity);
+            slopeAngleDegrees = rawSlopeAngle;
         float runBaseSpeedMultiplier = SCR_RSS_SpeedCalculator.CalculateBaseSpeedMultiplier(
             staminaPercent, collapseTransition, currentWorldTime);
         
@@ -276,8 +285,8 @@ class SCR_RSS_UpdateCoordinator
                     float gradePct = 0.0;
                     if (!shouldSuppressSlope)
                     {
-                        GradeCalculationResult gradeRes = SCR_RSS_SpeedCalculator.CalculateGradePercent(
-                            controller, currentSpeed, null, slopeAngleDegrees, environmentFactor, velocity);
+                        GradeCalculationResult gradeRes = SCR_RSS_SpeedCalculator.CalculateGradePercentFromSample(
+                            controller, currentSpeed, null, slopeSample, velocity);
                         gradePct = SCR_RSS_SpeedBridge.ClampGradePercentForMetabolicSpeed(
                             gradeRes.gradePercent);
                     }
@@ -332,10 +341,10 @@ class SCR_RSS_UpdateCoordinator
                     float gradePct = 0.0;
                     if (!shouldSuppressSlope)
                     {
-                        GradeCalculationResult gradeRes = SCR_RSS_SpeedCalculator.CalculateGradePercent(
-                            controller, currentSpeed, null, slopeAngleDegrees, environmentFactor, velocity);
-                        gradePct = controller.RSS_SmoothGradePercentForSpeed(
-                            gradeRes.gradePercent, currentWorldTime);
+                        GradeCalculationResult gradeRes = SCR_RSS_SpeedCalculator.CalculateGradePercentFromSample(
+                            controller, currentSpeed, null, slopeSample, velocity);
+                        gradePct = controller.RSS_GradePercentForSpeedCap(
+                            gradeRes.gradePercent, currentWorldTime, slopeSample, currentSpeed);
                     }
                     float runTerrain = terrainFactor;
                     if (runTerrain < 0.5)
@@ -582,6 +591,7 @@ class SCR_RSS_UpdateCoordinator
     // @param swimmingVelocityDebugPrinted 是否已输出游泳速度调试信息（输入）
     // @param owner 角色实体（用于调试）
     // @param environmentFactor 环境因子模块引用（v2.14.0修复：添加此参数以支持环境因子）
+    // @param metabolicContext 本 tick 代谢上下文（可选）
     // @return 基础消耗率结果（包含消耗率和调试标志）
     static BaseDrainRateResult CalculateBaseDrainRate(
         bool isSwimming,
@@ -598,7 +608,8 @@ class SCR_RSS_UpdateCoordinator
         int currentMovementPhase = -1,
         float appliedSpeedLimitMs = -1.0,
         float effectiveCriticalPowerWatts = -1.0,
-        float wPrimePool01 = 1.0)
+        float wPrimePool01 = 1.0,
+        SCR_RSS_MetabolicTickContext metabolicContext = null)
     {
         float baseDrainRate = 0.0;
         
@@ -665,7 +676,8 @@ class SCR_RSS_UpdateCoordinator
                 currentMovementPhase,
                 encumbranceSpeedPenalty,
                 effectiveCriticalPowerWatts,
-                wPrimePool01);
+                wPrimePool01,
+                metabolicContext);
 
             // 负重影响现在通过后续的 encumbranceStaminaDrainMultiplier 应用，
             // 因此不再需要对固定 Sprint 基线做特殊处理。
@@ -790,7 +802,8 @@ class SCR_RSS_UpdateCoordinator
             tick.currentMovementPhase,
             tick.appliedSpeedLimitMs,
             tick.effectiveCriticalPowerWatts,
-            tick.wPrimePool01);
+            tick.wPrimePool01,
+            tick.metabolicContext);
         result.baseDrainRateByVelocity = drainRateResult.baseDrainRate;
         result.swimmingVelocityDebugPrinted = drainRateResult.swimmingVelocityDebugPrinted;
 
@@ -883,6 +896,7 @@ class SCR_RSS_UpdateCoordinator
     // @param controller 角色控制器组件
     // @param environmentFactor 环境因子模块引用（v2.14.0新增）
     // @param timeDeltaSeconds 实际距上次更新的秒数（恢复/消耗率按每0.2s设计，需按 timeDelta/0.2 缩放）
+    // @param outRates 可选：写入本 tick 实际使用的恢复/消耗/净率，供 HUD/调试/API 直接读取
     // @return 新的目标体力值
     static float UpdateStaminaValue(
         SCR_CharacterStaminaComponent staminaComponent,
@@ -899,7 +913,8 @@ class SCR_RSS_UpdateCoordinator
         SCR_RSS_FatigueSystem fatigueSystem,
         SCR_CharacterControllerComponent controller,
         SCR_RSS_EnvironmentFactor environmentFactor = null,
-        float timeDeltaSeconds = 0.2)
+        float timeDeltaSeconds = 0.2,
+        StaminaTickRates outRates = null)
     {
         if (!staminaComponent)
             return staminaPercent;
@@ -927,13 +942,13 @@ class SCR_RSS_UpdateCoordinator
             false);
 
         // AI 伤害-体力联动（模块 F）
+        float injuryRecoveryMul = 1.0;
         if (controller && !controller.IsPlayerControlled() && SCR_RSS_ConfigBridge.IsAIInjuryLinkEnabled())
         {
             IEntity injuryOwner = controller.GetOwner();
             if (injuryOwner)
             {
                 float injuryDrainMul = 1.0;
-                float injuryRecoveryMul = 1.0;
                 if (SCR_RSS_AIInjuryLink.GetInjuryMultipliers(injuryOwner, injuryDrainMul, injuryRecoveryMul))
                 {
                     finalDrainRate = finalDrainRate * injuryDrainMul;
@@ -942,13 +957,38 @@ class SCR_RSS_UpdateCoordinator
             }
         }
         
+        SCR_RSS_StaminaNetRate.PublishTickRates(outRates, staminaPercent, recoveryRate, finalDrainRate);
+
         // 代谢净值算法：netChange = (recoveryRate - totalDrainRate) * (timeDelta/0.2)
-        // 恢复/消耗率按每0.2秒设计；实际更新间隔可能为50ms，需按时间比例缩放
-        float tickScale = Math.Clamp(timeDeltaSeconds / 0.2, 0.01, 2.0);
-        float netChange = (recoveryRate - finalDrainRate) * tickScale;
+        // 恢复/消耗率按每0.2秒设计；实际更新间隔可能为17ms~1.5s，需按时间比例缩放
+        // 长步（AI 远 LOD、玩家静止降频）按 ≤0.4s 分段：消耗率本 tick 不变，恢复率随体力变化需段首重算
+        float tickScale = Math.Max(timeDeltaSeconds / 0.2, 0.01);
+        int segments = Math.Ceil(tickScale / MAX_TICK_SCALE_PER_SEGMENT);
+        if (segments < 1)
+            segments = 1;
+        float segmentScale = tickScale / segments;
         
         // 更新目标体力值
-        newTargetStamina = staminaPercent + netChange;
+        newTargetStamina = staminaPercent;
+        for (int seg = 0; seg < segments; seg++)
+        {
+            if (seg > 0)
+            {
+                recoveryRate = SCR_RSS_StaminaNetRate.ComputeRecoveryRatePerTick(
+                    newTargetStamina,
+                    currentSpeed,
+                    baseDrainRateByVelocity,
+                    baseDrainRateByVelocityForModule,
+                    heatStressMultiplier,
+                    epocState,
+                    encumbranceCache,
+                    exerciseTracker,
+                    controller,
+                    environmentFactor,
+                    false) * injuryRecoveryMul;
+            }
+            newTargetStamina = Math.Clamp(newTargetStamina + (recoveryRate - finalDrainRate) * segmentScale, 0.0, 1.0);
+        }
         
         // ==================== 应用疲劳惩罚：限制最大体力上限（模块化）====================
         float maxStaminaCap = 1.0;
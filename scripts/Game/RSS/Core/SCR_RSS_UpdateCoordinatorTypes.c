@@ -66,6 +66,17 @@ class StaminaDrainTickParams
     float appliedSpeedLimitMs;
     float effectiveCriticalPowerWatts;
     float wPrimePool01;
+    SCR_RSS_MetabolicTickContext metabolicContext;
+}
+
+//! 单 tick 体力速率结果：UpdateStaminaValue 发布，HUD/调试/API/导出只读不重算
+class StaminaTickRates
+{
+    bool valid;
+    float staminaPercent;       // 计算所用体力（本 tick 更新前）
+    float recoveryPerTick;      // 恢复率（每 0.2 s，已含 AI 伤害倍率）
+    float finalDrainPerTick;    // 运动消耗 + EPOC（每 0.2 s，已含 AI 伤害倍率）
+    float netPerSec;            // (恢复 − 消耗) × 5；不含 UpdateStaminaValue 外叠加的超速税
 }
 
 class StaminaEtaResult
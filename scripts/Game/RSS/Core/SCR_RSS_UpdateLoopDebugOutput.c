@@ -47,8 +47,8 @@ class SCR_RSS_UpdateLoopDebugOutput
             if (fatigueSystem && SCR_RSS_ConfigBridge.IsFatigueSystemEnabled())
                 targetStamina = fatigueSystem.GetMaxStaminaCap();
 
-            StaminaEtaResult eta = SCR_RSS_StaminaNetRate.ComputeStaminaEta(
-                tick.staminaPercent,
+            StaminaEtaResult eta = SCR_RSS_StaminaNetRate.ComputeStaminaEtaFromRates(
+                tick.rates,
                 targetStamina,
                 tick.useSwimmingModel,
                 tick.currentSpeed,
@@ -75,13 +75,7 @@ class SCR_RSS_UpdateLoopDebugOutput
 
         if (needDebugOutput || needHintOutput)
         {
-            SCR_RSS_DebugDisplay.OutputStaminaDrainDiagnostics(
-                tick,
-                ctrl,
-                epocState,
-                encumbranceCache,
-                exerciseTracker,
-                environmentFactor);
+            SCR_RSS_DebugDisplay.OutputStaminaDrainDiagnostics(tick, ctrl);
         }
 
         DebugInfoParams debugParams = new DebugInfoParams();
@@ -17,7 +17,8 @@ class SCR_RSS_UpdateLoopMetabDebug
         out float metabPowerMetDbg,
         out float metabPowerRawDbg,
         out float metabCpDbg,
-        out float metabAerobicDbg)
+        out float metabAerobicDbg,
+        SCR_RSS_MetabolicTickContext ctx = null)
     {
         metabPowerDbg = -1.0;
         metabPowerMetDbg = -1.0;
@@ -40,12 +41,12 @@ class SCR_RSS_UpdateLoopMetabDebug
         if (drainVelDbg < SCR_RSS_Constants.RSS_IDLE_SPEED_THRESHOLD_MPS)
             return;
 
-        metabPowerMetDbg = SCR_RSS_MetabolismModel.MetabolismPowerWatts(
+        metabPowerMetDbg = SCR_RSS_DrainCalculator.EvalPowerWatts(
+            ctx,
             drainVelDbg,
             totalWeightWithWetAndBody,
             gradePercent,
             terrainFactor,
-            true,
             effectiveMovementPhase);
         if (metabCpDbg <= 1.0)
         {
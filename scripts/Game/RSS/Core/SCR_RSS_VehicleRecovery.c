@@ -0,0 +1,296 @@
+//! 载具乘员恢复：约 1 Hz 的解析推进（SCR_PlayerBaseVehicleHelper 的降频路径）
+//!
+//! 载具内恢复上下文固定：负重 0、趴姿倍率、速度 0、无环境惩罚、无 EPOC、无移动消耗。
+//! 每 tick 恢复率 r(S) = G·(1 + a(1 − S))·m(S)，m 为边际衰减（阈值以上 c − S，钳在 [0.2, 1]），
+//! 再经最低阈值封锁、绝境/静态保底与单 tick 上限（与 CalculateRecoveryRate 顺序一致）。
+//! 按断点分段后 dS/dt 在段内为常数、S 的一次式或二次式，逐段闭式积分：
+//!   一次：dS/dt = A − B·S → S(t) = σ − (σ − S₀)·e^(−B·t)，σ = A/B
+//!   二次：Q = (σ − S)/(c − S)，Q(t) = Q₀·e^(k·a·(σ − c)·t)
+//! 休息/疲劳相关倍数在区间内视为常数；G 由 CalculateMultiDimensionalRecoveryRate 在参考点反推，
+//! 不复制休息/疲劳/姿态倍数。对照：tools/test_vehicle_recovery.py（解析推进 vs 逐 tick 欧拉）
+
+class SCR_RSS_VehicleRecovery
+{
+    static const int TICK_INTERVAL_MS = 1000;
+    //! 单次推进的最大区间（卡顿时截断，与逐 tick 路径的 0.5 s 截断同义）
+    static const float MAX_INTERVAL_SEC = 2.0;
+    //! 解析率与 GetNetStaminaRatePerSecond 的相对偏差超过该值时退回单步欧拉
+    static const float PARITY_REL_TOL = 0.001;
+
+    static const float DESPERATION_STAMINA = 0.02;
+    static const float DESPERATION_FLOOR_PER_TICK = 0.0001;
+    static const float STATIC_FLOOR_TRIGGER_PER_TICK = 0.00005;
+
+    protected static const float NATURAL_E = 2.718281828459045;
+    protected static const float LN2 = 0.6931471805599453;
+    protected static const int MAX_SEGMENTS = 16;
+    protected static const int BOUNDARY_BISECTION_STEPS = 24;
+
+    protected static const int LAW_CONSTANT = 0;
+    protected static const int LAW_LINEAR = 1;
+    protected static const int LAW_QUADRATIC = 2;
+
+    protected float m_fGain;
+    protected float m_fNonlinear;
+    protected float m_fDecayThreshold;
+    protected float m_fDecayCoeff;
+    protected float m_fBlockedBelow;
+    protected float m_fMaxPerTick;
+    protected float m_fPerSecondScale;
+    protected ref array<float> m_aBreaks = new array<float>();
+
+    //------------------------------------------------------------------------------------------------
+    //! 以当前休息/运动时长固化系数与分段断点
+    void Prepare(float restDurationMinutes, float exerciseDurationMinutes)
+    {
+        m_fNonlinear = SCR_RSS_ConfigBridge.GetRecoveryNonlinearCoeff();
+        m_fDecayThreshold = SCR_RSS_ConfigBridge.GetMarginalDecayThreshold();
+        m_fDecayCoeff = SCR_RSS_ConfigBridge.GetMarginalDecayCoeff();
+        m_fMaxPerTick = SCR_RSS_ConfigBridge.GetMaxRecoveryPerTick();
+        m_fPerSecondScale = 5.0 * SCR_RSS_ConfigBridge.GetCustomStaminaRecoveryMultiplier();
+
+        float minThreshold = SCR_RSS_ConfigBridge.GetMinRecoveryStaminaThreshold();
+        m_fBlockedBelow = -1.0;
+        if (Math.Max(restDurationMinutes, 0.0) * 60.0 < SCR_RSS_ConfigBridge.GetMinRecoveryRestTimeSeconds())
+            m_fBlockedBelow = minThreshold;
+
+        // 参考点取在封锁阈值之上、边际衰减之下：r = G·shape
+        float sRef = 0.5 * (Math.Max(minThreshold, DESPERATION_STAMINA) + Math.Min(m_fDecayThreshold, 1.0));
+        float shapeRef = 1.0 + m_fNonlinear * (1.0 - sRef);
+        float rateRef = SCR_RSS_MetabolismMath.CalculateMultiDimensionalRecoveryRate(
+            sRef, restDurationMinutes, exerciseDurationMinutes, 0.0, 2);
+        m_fGain = 0.0;
+        if (shapeRef > 0.0)
+            m_fGain = rateRef / shapeRef;
+
+        m_aBreaks.Clear();
+        AddBreak(DESPERATION_STAMINA);
+        AddBreak(m_fBlockedBelow);
+        AddBreak(m_fDecayThreshold);
+        AddBreak(m_fDecayCoeff - 1.0);
+        AddBreak(m_fDecayCoeff - 0.2);
+        AddBreak(FormulaCrossing(STATIC_FLOOR_TRIGGER_PER_TICK));
+        AddBreak(FormulaCrossing(DESPERATION_FLOOR_PER_TICK));
+        if (m_fMaxPerTick > 0.0)
+            AddBreak(FormulaCrossing(m_fMaxPerTick));
+        m_aBreaks.Sort();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 与逐 tick 路径相同的每 tick 恢复率（未乘自定义倍率）
+    float RawPerTick(float staminaPercent)
+    {
+        float s = Math.Clamp(staminaPercent, 0.0, 1.0);
+        float raw = 0.0;
+        if (s >= m_fBlockedBelow)
+            raw = Formula(s);
+
+        if (s < DESPERATION_STAMINA)
+            raw = Math.Max(raw, DESPERATION_FLOOR_PER_TICK);
+        if (raw < STATIC_FLOOR_TRIGGER_PER_TICK)
+            raw = DESPERATION_FLOOR_PER_TICK;
+        if (m_fMaxPerTick > 0.0 && raw > m_fMaxPerTick)
+            raw = m_fMaxPerTick;
+        return raw;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float RatePerSecond(float staminaPercent)
+    {
+        return RawPerTick(staminaPercent) * m_fPerSecondScale;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 从 staminaPercent 起恢复 intervalSec 秒，结果不超过 staminaCap
+    float Advance(float staminaPercent, float intervalSec, float staminaCap)
+    {
+        float s = staminaPercent;
+        float remaining = intervalSec;
+        for (int seg = 0; seg < MAX_SEGMENTS && remaining > 0.0 && s < staminaCap; seg++)
+        {
+            float next = NextBreak(s, staminaCap);
+            float probe = 0.5 * (s + next);
+
+            int law = LAW_CONSTANT;
+            float rate = RatePerSecond(probe);
+            float marginal = 1.0;
+            if (probe >= m_fBlockedBelow && RawPerTick(probe) == Formula(probe))
+            {
+                law = LAW_LINEAR;
+                if (probe > m_fDecayThreshold)
+                {
+                    marginal = m_fDecayCoeff - probe;
+                    if (marginal > 0.2 && marginal < 1.0)
+                        law = LAW_QUADRATIC;
+                    else
+                        marginal = Math.Clamp(marginal, 0.2, 1.0);
+                }
+            }
+
+            float k = m_fGain * m_fPerSecondScale;
+            float timeToNext = TimeToReach(law, s, next, rate, k, marginal);
+            if (timeToNext >= remaining)
+                return Math.Min(Evolve(law, s, remaining, rate, k, marginal), staminaCap);
+
+            s = next;
+            remaining -= timeToNext;
+        }
+        return Math.Min(s, staminaCap);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 未经保底/上限的乘数链（单调递减）
+    protected float Formula(float s)
+    {
+        float marginal = 1.0;
+        if (s > m_fDecayThreshold)
+            marginal = Math.Clamp(m_fDecayCoeff - s, 0.2, 1.0);
+        return m_fGain * (1.0 + m_fNonlinear * (1.0 - s)) * marginal;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected float FormulaCrossing(float perTick)
+    {
+        if (Formula(0.0) < perTick || Formula(1.0) > perTick)
+            return -1.0;
+
+        float lo = 0.0;
+        float hi = 1.0;
+        for (int i = 0; i < BOUNDARY_BISECTION_STEPS; i++)
+        {
+            float mid = 0.5 * (lo + hi);
+            if (Formula(mid) > perTick)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        return 0.5 * (lo + hi);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void AddBreak(float s)
+    {
+        if (s > 0.0 && s < 1.0)
+            m_aBreaks.Insert(s);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected float NextBreak(float s, float staminaCap)
+    {
+        foreach (float b : m_aBreaks)
+        {
+            if (b > s + 0.000001 && b < staminaCap)
+                return b;
+        }
+        return staminaCap;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 一次律 dS/dt = A − B·S 的系数；二次律在 a≈0 时退化为一次律
+    protected void LinearCoefficients(int law, float k, float marginal, out float coeffA, out float coeffB)
+    {
+        if (law == LAW_QUADRATIC)
+        {
+            coeffA = k * m_fDecayCoeff;
+            coeffB = k;
+            return;
+        }
+        coeffA = k * marginal * (1.0 + m_fNonlinear);
+        coeffB = k * marginal * m_fNonlinear;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected bool IsTrueQuadratic(int law, float k)
+    {
+        return law == LAW_QUADRATIC && m_fNonlinear > 0.000001 && k > 0.0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected float TimeToReach(int law, float s0, float s1, float rate, float k, float marginal)
+    {
+        if (IsTrueQuadratic(law, k))
+        {
+            float a = m_fNonlinear;
+            float sigma = (1.0 + a) / a;
+            float c = m_fDecayCoeff;
+            if (Math.AbsFloat(sigma - c) < 0.000001)
+                return (1.0 / (c - s1) - 1.0 / (c - s0)) / (a * k);
+            float q0 = (sigma - s0) / (c - s0);
+            float q1 = (sigma - s1) / (c - s1);
+            return Ln(q1 / q0) / (a * k * (sigma - c));
+        }
+
+        if (law != LAW_CONSTANT)
+        {
+            float coeffA;
+            float coeffB;
+            LinearCoefficients(law, k, marginal, coeffA, coeffB);
+            if (coeffB > 0.0)
+                return Ln((coeffA - coeffB * s0) / (coeffA - coeffB * s1)) / coeffB;
+            rate = coeffA;
+        }
+        if (rate <= 0.0)
+            return 1000000.0;
+        return (s1 - s0) / rate;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected float Evolve(int law, float s0, float t, float rate, float k, float marginal)
+    {
+        if (IsTrueQuadratic(law, k))
+        {
+            float a = m_fNonlinear;
+            float sigma = (1.0 + a) / a;
+            float c = m_fDecayCoeff;
+            if (Math.AbsFloat(sigma - c) < 0.000001)
+                return c - 1.0 / (1.0 / (c - s0) + a * k * t);
+            float q = (sigma - s0) / (c - s0) * Math.Pow(NATURAL_E, a * k * (sigma - c) * t);
+            return (sigma - q * c) / (1.0 - q);
+        }
+
+        if (law != LAW_CONSTANT)
+        {
+            float coeffA;
+            float coeffB;
+            LinearCoefficients(law, k, marginal, coeffA, coeffB);
+            if (coeffB > 0.0)
+            {
+                float sigmaLin = coeffA / coeffB;
+                return sigmaLin - (sigmaLin - s0) * Math.Pow(NATURAL_E, -coeffB * t);
+            }
+            rate = coeffA;
+        }
+        return s0 + rate * t;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 自然对数：折半归约到 [1, 2) 后用 2·atanh 级数（|y| ≤ 1/3，8 项误差 < 1e-8）
+    protected static float Ln(float x)
+    {
+        if (x <= 0.0)
+            return 0.0;
+
+        int k = 0;
+        while (x >= 2.0)
+        {
+            x *= 0.5;
+            k++;
+        }
+        while (x < 1.0)
+        {
+            x *= 2.0;
+            k--;
+        }
+
+        float y = (x - 1.0) / (x + 1.0);
+        float y2 = y * y;
+        float term = y;
+        float sum = 0.0;
+        for (int n = 1; n <= 15; n += 2)
+        {
+            sum += term / n;
+            term *= y2;
+        }
+        return 2.0 * sum + k * LN2;
+    }
+}
@@ -1,35 +1,98 @@
 //! 专服 W′ 补 tick（从 PlayerBase.c 拆分）
+//!
+//! 玩家体力主循环在客户端跑，服务器只补推进无氧池并权威写 RplProp。
+//! 以前每个玩家在自己的 OnPrepareControls 里逐帧判定、各自读世界时间与配置、每次都 BumpMe；
+//! 现在玩家在首次需要补 tick 时登记，服务器按 PASS_INTERVAL_MS 跑一次批量 pass：
+//! 世界时间与 W′ 配置每 pass 读一次，只有量化后的池值（或冷却截止）变化的实体才 BumpMe。
+//! 登记表随世界切换重建；实体删除、或改由服务器本地跑主循环时移出。
 
 class SCR_RSS_WPrimeServerTick
 {
-    //! 玩家主循环不在服务端跑时补 tick 无氧池；返回是否执行了 tick
-    static bool MaybeTick(
-        bool isServer,
-        bool isPlayerControlled,
-        bool shouldProcessStaminaUpdate,
+    //! 批量 pass 周期（ms）；与玩家全速 tick 同量级，W′ 积分步长受下方 clamp 约束
+    static const int PASS_INTERVAL_MS = 100;
+    //! 复制量化步数：池值按 1/REPL_POOL_STEPS 取整后变化才 BumpMe（0.5%，低于 HUD 可辨识度）
+    static const float REPL_POOL_STEPS = 200.0;
+
+    protected static ref SCR_RSS_WPrimeServerTick s_pInstance;
+
+    protected World m_pWorld;
+    protected bool m_bPassScheduled = false;
+    protected ref array<SCR_CharacterControllerComponent> m_aController;
+
+    //------------------------------------------------------------------------------------------------
+    void SCR_RSS_WPrimeServerTick()
+    {
+        m_aController = new array<SCR_CharacterControllerComponent>();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 当前世界的登记表；世界切换（换图/重开）时丢弃旧表
+    static SCR_RSS_WPrimeServerTick Get()
+    {
+        World world = null;
+        if (GetGame())
+            world = GetGame().GetWorld();
+        if (!s_pInstance || s_pInstance.m_pWorld != world)
+        {
+            s_pInstance = new SCR_RSS_WPrimeServerTick();
+            s_pInstance.m_pWorld = world;
+        }
+        return s_pInstance;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    int Count()
+    {
+        return m_aController.Count();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 登记玩家控制器；首个登记者启动 pass
+    void Register(SCR_CharacterControllerComponent ctrl)
+    {
+        if (!ctrl || m_aController.Find(ctrl) >= 0)
+            return;
+        m_aController.Insert(ctrl);
+        SchedulePass();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void Unregister(SCR_CharacterControllerComponent ctrl)
+    {
+        int idx = m_aController.Find(ctrl);
+        if (idx >= 0)
+            m_aController.Remove(idx);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 池值是否跨过复制量化步（或冷却截止变化），决定是否 BumpMe
+    static bool ReplicationChanged(float oldPool, float newPool, float oldCooldownUntil, float newCooldownUntil)
+    {
+        if (oldCooldownUntil != newCooldownUntil)
+            return true;
+        // 满池/空池精确落地，避免客户端停在差半步的值上
+        if ((newPool >= 1.0 || newPool <= 0.0) && newPool != oldPool)
+            return true;
+        return Math.Round(oldPool * REPL_POOL_STEPS) != Math.Round(newPool * REPL_POOL_STEPS);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 单实体推进：距上次推进不足半个 pass 跳过；步长取实际间隔并限制在 [0.01, 0.5] s
+    //! \return 是否执行了 tick
+    static bool TickOne(
         SCR_RSS_AnaerobicBurst anaerobicBurst,
         SCR_RSS_StaminaState staminaState,
         bool isSprintActive,
         float aerobicPercent,
-        float intervalSec,
-        inout float lastStaminaUpdateTime,
-        out float replPool,
-        out float replCooldownUntil)
+        float currentTime,
+        float idlePowerW,
+        float sprintPowerW,
+        inout float lastStaminaUpdateTime)
     {
-        replPool = 1.0;
-        replCooldownUntil = -1.0;
-
-        if (!isServer || !isPlayerControlled)
-            return false;
         if (!anaerobicBurst)
             return false;
-        if (shouldProcessStaminaUpdate)
-            return false;
-        if (!GetGame() || !GetGame().GetWorld())
-            return false;
 
-        float currentTime = GetGame().GetWorld().GetWorldTime() / 1000.0;
-        float useInterval = intervalSec;
+        float useInterval = PASS_INTERVAL_MS / 1000.0;
         if (lastStaminaUpdateTime >= 0.0)
         {
             float elapsed = currentTime - lastStaminaUpdateTime;
@@ -38,19 +101,54 @@ class SCR_RSS_WPrimeServerTick
             useInterval = Math.Clamp(elapsed, 0.01, 0.5);
         }
 
-        float anaDrain = SCR_RSS_ConfigBridge.GetWPrimeDrainPerSec();
-        float powerW = SCR_RSS_Constants.V6_CRITICAL_POWER_WATTS_DEFAULT;
+        float powerW = idlePowerW;
         if (isSprintActive)
-            powerW = powerW + anaDrain * SCR_RSS_ConfigBridge.GetWPrimeMaxJoules() * 0.01;
+            powerW = sprintPowerW;
         anaerobicBurst.TickPower(powerW, isSprintActive, currentTime, useInterval);
         if (staminaState)
         {
             staminaState.SetWPrimePool01(anaerobicBurst.GetPool());
             staminaState.SetAerobic(aerobicPercent);
         }
-        SCR_RSS_NetworkSyncManager.ReadAnaerobicForReplication(
-            anaerobicBurst, replPool, replCooldownUntil);
         lastStaminaUpdateTime = currentTime;
         return true;
     }
+
+    //------------------------------------------------------------------------------------------------
+    protected void SchedulePass()
+    {
+        if (m_bPassScheduled || !GetGame() || !GetGame().GetCallqueue())
+            return;
+        m_bPassScheduled = true;
+        GetGame().GetCallqueue().CallLater(RunPass, PASS_INTERVAL_MS, false);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 批量 pass：世界时间与配置读一次，线性遍历登记表；不再需要补 tick 的实体顺带移出
+    protected void RunPass()
+    {
+        m_bPassScheduled = false;
+        if (s_pInstance != this || !GetGame() || !GetGame().GetWorld() || GetGame().GetWorld() != m_pWorld)
+            return;
+
+        float currentTime = m_pWorld.GetWorldTime() / 1000.0;
+        float idlePowerW = SCR_RSS_Constants.V6_CRITICAL_POWER_WATTS_DEFAULT;
+        float sprintPowerW = idlePowerW
+            + SCR_RSS_ConfigBridge.GetWPrimeDrainPerSec() * SCR_RSS_ConfigBridge.GetWPrimeMaxJoules() * 0.01;
+
+        int i = 0;
+        while (i < m_aController.Count())
+        {
+            SCR_CharacterControllerComponent ctrl = m_aController[i];
+            if (!ctrl || !ctrl.RSS_ServerWPrimePassStep(currentTime, idlePowerW, sprintPowerW))
+            {
+                m_aController.Remove(i);
+                continue;
+            }
+            i++;
+        }
+
+        if (!m_aController.IsEmpty())
+            SchedulePass();
+    }
 }
@@ -0,0 +1,88 @@
+//! 日内气温查表（SCR_RSS_AstronomyMath.CalculateUniversalTemperature 的逐日预计算版本）
+//!
+//! 纬度与 dayOfYear 在整个游戏日内不变：日期或位置变化时重算纬度季节基准气温，
+//! 昼夜正弦相位按 96 个采样点（15 分钟步长）预存，运行时线性插值。
+//! 与天气相关的项（阴天/雾阻尼、海拔、降雨降温）仍在运行时叠加，与原公式逐项一致。
+//! 表按 (纬度, dayOfYear) 键自动重建，地图或配置切换无需显式失效。
+//! 精度对照见 tools/test_astronomy_day_table.py。
+
+class SCR_RSS_AstronomyDayTable
+{
+    static const int SAMPLES_PER_DAY = 96;
+    static const float HOURS_PER_SAMPLE = 0.25;
+    //! 纬度变化小于该值不重建（浮点漂移不应触发重算）
+    static const float KEY_EPSILON = 0.001;
+
+    protected static ref array<float> s_aDailyPhaseSin;
+
+    protected static bool s_bBuilt;
+    protected static float s_fLatitude;
+    protected static int s_iDayOfYear;
+    //! 纬度基准 + 季节偏差（与小时、天气无关）
+    protected static float s_fBaselineTemp;
+
+    //------------------------------------------------------------------------------------------------
+    //! 键变化时重建；返回是否发生了重建
+    static bool EnsureDay(float latitude, int dayOfYear)
+    {
+        if (s_bBuilt
+            && s_iDayOfYear == dayOfYear
+            && Math.AbsFloat(s_fLatitude - latitude) < KEY_EPSILON)
+            return false;
+
+        Build(latitude, dayOfYear);
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 查表版 CalculateUniversalTemperature；参数与返回值语义相同
+    static float SampleUniversalTemperature(float latitude, int dayOfYear, float hourOfDay, float altitudeMeters, float overcast, float rainIntensity, float fogDensity)
+    {
+        EnsureDay(latitude, dayOfYear);
+
+        float damping = 1.0 - (overcast * 0.5) - (fogDensity * 0.3);
+        float currentRange = SCR_RSS_AstronomyMath.DAILY_TEMP_RANGE * Math.Max(0.2, damping);
+        float dailyTemp = (currentRange / 2.0) * Interpolate(s_aDailyPhaseSin, hourOfDay);
+        float altTemp = (altitudeMeters / 1000.0) * 6.5;
+
+        float currentBase = s_fBaselineTemp + dailyTemp - altTemp;
+        return currentBase - SCR_RSS_AstronomyMath.RainCooling(currentBase, rainIntensity);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static void Build(float latitude, int dayOfYear)
+    {
+        // 相位表与纬度/日期无关，只建一次；末尾多存一个 24:00 点，插值无需回绕分支
+        if (!s_aDailyPhaseSin)
+        {
+            int count = SAMPLES_PER_DAY + 1;
+            s_aDailyPhaseSin = new array<float>();
+            s_aDailyPhaseSin.Resize(count);
+            for (int i = 0; i < count; i++)
+            {
+                float hour = i * HOURS_PER_SAMPLE;
+                s_aDailyPhaseSin[i] = Math.Sin((hour - 9.5) / 24.0 * 2.0 * Math.PI);
+            }
+        }
+
+        s_fBaselineTemp = SCR_RSS_AstronomyMath.BaselineTemperature(latitude, dayOfYear);
+        s_fLatitude = latitude;
+        s_iDayOfYear = dayOfYear;
+        s_bBuilt = true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static float Interpolate(array<float> table, float hourOfDay)
+    {
+        float h = hourOfDay;
+        while (h < 0.0) h += 24.0;
+        while (h >= 24.0) h -= 24.0;
+
+        float pos = h / HOURS_PER_SAMPLE;
+        int i0 = Math.Floor(pos);
+        if (i0 >= SAMPLES_PER_DAY)
+            i0 = SAMPLES_PER_DAY - 1;
+        float frac = pos - i0;
+        return table[i0] + (table[i0 + 1] - table[i0]) * frac;
+    }
+}
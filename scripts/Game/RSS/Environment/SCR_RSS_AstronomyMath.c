@@ -2,6 +2,22 @@
 class SCR_RSS_AstronomyMath
 {
     static const float NATURAL_E = 2.718281828459045;
+    static const float DAILY_TEMP_RANGE = 10.0;
+
+    // 网格搜索结果按地图/日期/时区/观测日出日落缓存：同一键下引擎日出日落确定，只有云量置信度修正需要每次重算；
+    // 地图切换与时区配置变化都会改变键，无需显式失效
+    protected static bool s_bSearchCached;
+    protected static string s_sSearchWorld;
+    protected static int s_iSearchYear;
+    protected static int s_iSearchMonth;
+    protected static int s_iSearchDay;
+    protected static float s_fSearchTz;
+    protected static float s_fSearchDst;
+    protected static float s_fSearchObsSR;
+    protected static float s_fSearchObsSS;
+    protected static float s_fSearchLat;
+    protected static float s_fSearchLon;
+    protected static float s_fSearchErr;
 
     static int DayOfYear(int year, int month, int day)
     {
@@ -214,8 +230,75 @@ class SCR_RSS_AstronomyMath
         float obsNoon = (obsSR + obsSS) * 0.5;
         while (obsNoon >= 24.0) obsNoon -= 24.0;
 
-        float bestErr = 1e9, bestLat = 0.0, bestLon = 0.0;
-        const float wL = 1.0, wNoon = 0.5, wMoon = 0.3;
+        string worldKey = "";
+        if (GetGame())
+            worldKey = GetGame().GetWorldFile();
+
+        // 网格搜索只依赖地图/日期/时区与观测日出日落，同键复用（原先每次约 3000 次引擎天文调用）
+        float bestErr, bestLat, bestLon;
+        if (IsSearchCached(worldKey, year, month, day, tz, dst, obsSR, obsSS))
+        {
+            bestErr = s_fSearchErr;
+            bestLat = s_fSearchLat;
+            bestLon = s_fSearchLon;
+        }
+        else
+        {
+            bestErr = SearchLatLongGrid(weatherManager, year, month, day, tz, dst,
+                obsL, obsNoon, bestLat, bestLon);
+
+            s_bSearchCached = true;
+            s_sSearchWorld = worldKey;
+            s_iSearchYear = year;
+            s_iSearchMonth = month;
+            s_iSearchDay = day;
+            s_fSearchTz = tz;
+            s_fSearchDst = dst;
+            s_fSearchObsSR = obsSR;
+            s_fSearchObsSS = obsSS;
+            s_fSearchErr = bestErr;
+            s_fSearchLat = bestLat;
+            s_fSearchLon = bestLon;
+        }
+
+        const float wMoon = 0.3;
+        float moon_c = weatherManager.GetMoonPhaseForDate(year, month, day, tod, tz, dst);
+        bestErr += wMoon * Math.AbsFloat(obsMoonPhase - moon_c);
+
+        const float maxAcceptableErr = 12.0;
+        float errScore = Math.Clamp(bestErr / maxAcceptableErr, 0.0, 1.0);
+        float conf = 1.0 - errScore;
+        float cloud = InferCloudFactor(rainIntensity, surfaceWetness, weatherManager);
+        conf -= Math.Clamp(cloud * 0.5, 0.0, 0.5);
+        conf = Math.Clamp(conf, 0.0, 1.0);
+
+        outLatDeg = bestLat;
+        outLonDeg = bestLon;
+        return conf;
+    }
+
+    protected static bool IsSearchCached(string worldKey, int year, int month, int day, float tz, float dst, float obsSR, float obsSS)
+    {
+        if (!s_bSearchCached)
+            return false;
+        return s_sSearchWorld == worldKey
+            && s_iSearchYear == year && s_iSearchMonth == month && s_iSearchDay == day
+            && s_fSearchTz == tz && s_fSearchDst == dst
+            && s_fSearchObsSR == obsSR && s_fSearchObsSS == obsSS;
+    }
+
+    // 粗网格 + 三轮细化搜索；返回昼长/正午误差最小值，outLat/outLon 为对应经纬度
+    // 月相项与经纬度无关，不影响 argmin，由调用方在缓存外单独叠加
+    protected static float SearchLatLongGrid(
+        TimeAndWeatherManagerEntity weatherManager,
+        int year, int month, int day, float tz, float dst,
+        float obsL, float obsNoon,
+        out float outLatDeg, out float outLonDeg)
+    {
+        float bestErr = 1e9;
+        outLatDeg = 0.0;
+        outLonDeg = 0.0;
+        const float wL = 1.0, wNoon = 0.5;
 
         // 粗网格（步长 5°）
         for (float lat = -85.0; lat <= 85.0; lat += 5.0)
@@ -237,9 +320,8 @@ class SCR_RSS_AstronomyMath
                 float Lc = ss_c - sr_c;
                 float noon_c = (sr_c + ss_c) * 0.5;
                 while (noon_c >= 24.0) noon_c -= 24.0;
-                float moon_c = weatherManager.GetMoonPhaseForDate(year, month, day, tod, tz, dst);
-                float err = wL * Math.AbsFloat(obsL - Lc) + wNoon * Math.AbsFloat(obsNoon - noon_c) + wMoon * Math.AbsFloat(obsMoonPhase - moon_c) + penalty;
-                if (err < bestErr) { bestErr = err; bestLat = lat; bestLon = lon; }
+                float err = wL * Math.AbsFloat(obsL - Lc) + wNoon * Math.AbsFloat(obsNoon - noon_c) + penalty;
+                if (err < bestErr) { bestErr = err; outLatDeg = lat; outLonDeg = lon; }
             }
         }
 
@@ -247,14 +329,14 @@ class SCR_RSS_AstronomyMath
         float searchRadius = 5.0, step = 1.0;
         for (int iter = 0; iter < 3; iter++)
         {
-            float localBestErr = bestErr, localBestLat = bestLat, localBestLon = bestLon;
-            for (float lat = bestLat - searchRadius; lat <= bestLat + searchRadius; lat += step)
+            float localBestErr = bestErr, localBestLat = outLatDeg, localBestLon = outLonDeg;
+            for (float lat = outLatDeg - searchRadius; lat <= outLatDeg + searchRadius; lat += step)
             {
                 if (lat < -89.9 || lat > 89.9)
                 {
                     continue;
                 }
-                for (float lon = bestLon - searchRadius; lon <= bestLon + searchRadius; lon += step)
+                for (float lon = outLonDeg - searchRadius; lon <= outLonDeg + searchRadius; lon += step)
                 {
                     float sr_c = 0.0, ss_c = 0.0;
                     bool okSR = weatherManager.GetSunriseHourForDate(year, month, day, lat, lon, tz, dst, sr_c);
@@ -271,31 +353,38 @@ class SCR_RSS_AstronomyMath
                     float Lc = ss_c - sr_c;
                     float noon_c = (sr_c + ss_c) * 0.5;
                     while (noon_c >= 24.0) noon_c -= 24.0;
-                    float moon_c = weatherManager.GetMoonPhaseForDate(year, month, day, tod, tz, dst);
-                    float err = wL * Math.AbsFloat(obsL - Lc) + wNoon * Math.AbsFloat(obsNoon - noon_c) + wMoon * Math.AbsFloat(obsMoonPhase - moon_c) + penalty;
+                    float err = wL * Math.AbsFloat(obsL - Lc) + wNoon * Math.AbsFloat(obsNoon - noon_c) + penalty;
                     if (err < localBestErr) { localBestErr = err; localBestLat = lat; localBestLon = lon; }
                 }
             }
-            bestErr = localBestErr; bestLat = localBestLat; bestLon = localBestLon;
+            bestErr = localBestErr; outLatDeg = localBestLat; outLonDeg = localBestLon;
             searchRadius = Math.Max(0.5, searchRadius * 0.5);
             step = Math.Max(0.1, step * 0.5);
         }
 
-        const float maxAcceptableErr = 12.0;
-        float errScore = Math.Clamp(bestErr / maxAcceptableErr, 0.0, 1.0);
-        float conf = 1.0 - errScore;
-        float cloud = InferCloudFactor(rainIntensity, surfaceWetness, weatherManager);
-        conf -= Math.Clamp(cloud * 0.5, 0.0, 0.5);
-        conf = Math.Clamp(conf, 0.0, 1.0);
-
-        outLatDeg = bestLat;
-        outLonDeg = bestLon;
-        return conf;
+        return bestErr;
     }
 
     // 正弦波叠加气温模型：纯数学拟合，无辐射求解，极轻量且稳定
     // T = T_纬度基准 + T_季节偏差 + T_昼夜波动 - T_海拔衰减 + T_天气修正
+    // 热路径请用 SCR_RSS_AstronomyDayTable.SampleUniversalTemperature（逐日查表）；本函数为参考实现
     static float CalculateUniversalTemperature(float latitude, int dayOfYear, float hourOfDay, float altitudeMeters, float overcast, float rainIntensity, float fogDensity)
+    {
+        float baseline = BaselineTemperature(latitude, dayOfYear);
+
+        float damping = 1.0 - (overcast * 0.5) - (fogDensity * 0.3);
+        float currentRange = DAILY_TEMP_RANGE * Math.Max(0.2, damping);
+        float hourPhase = (hourOfDay - 9.5) / 24.0 * 2.0 * Math.PI;
+        float dailyTemp = (currentRange / 2.0) * Math.Sin(hourPhase);
+
+        float altTemp = (altitudeMeters / 1000.0) * 6.5;
+
+        float currentBase = baseline + dailyTemp - altTemp;
+        return currentBase - RainCooling(currentBase, rainIntensity);
+    }
+
+    // 纬度基准 + 季节偏差：只依赖纬度与 dayOfYear，一个游戏日内恒定
+    static float BaselineTemperature(float latitude, int dayOfYear)
     {
         float latRad = latitude * Math.PI / 180.0;
         float baseTemp = 27.0 - 42.0 * Math.Pow(Math.Sin(latRad), 2.0);
@@ -307,25 +396,17 @@ class SCR_RSS_AstronomyMath
             hemisphere = -1.0;
         else
             hemisphere = 1.0;
-        float seasonTemp = hemisphere * seasonRange * Math.Cos(yearPhase);
-
-        const float dailyRange = 10.0;
-        float damping = 1.0 - (overcast * 0.5) - (fogDensity * 0.3);
-        float currentRange = dailyRange * Math.Max(0.2, damping);
-        float hourPhase = (hourOfDay - 9.5) / 24.0 * 2.0 * Math.PI;
-        float dailyTemp = (currentRange / 2.0) * Math.Sin(hourPhase);
-
-        float altTemp = (altitudeMeters / 1000.0) * 6.5;
-
-        float currentBase = baseTemp + seasonTemp + dailyTemp - altTemp;
-        float rainCooling = 0.0;
-        if (currentBase > 10.0 && rainIntensity > 0.0)
-        {
-            rainCooling = rainIntensity * 5.0 * ((currentBase - 10.0) / 20.0);
-            if (rainCooling > 5.0)
-                rainCooling = 5.0;
-        }
+        return baseTemp + hemisphere * seasonRange * Math.Cos(yearPhase);
+    }
 
-        return currentBase - rainCooling;
+    // 降雨降温：仅在基准气温高于 10°C 时生效，上限 5°C
+    static float RainCooling(float currentBase, float rainIntensity)
+    {
+        if (currentBase <= 10.0 || rainIntensity <= 0.0)
+            return 0.0;
+        float rainCooling = rainIntensity * 5.0 * ((currentBase - 10.0) / 20.0);
+        if (rainCooling > 5.0)
+            rainCooling = 5.0;
+        return rainCooling;
     }
 }
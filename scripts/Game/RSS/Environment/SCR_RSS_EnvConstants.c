@@ -21,6 +21,9 @@ class SCR_RSS_EnvConstants
     
     // 环境因子检测频率（性能优化）
     static const float ENV_CHECK_INTERVAL = 10.0; // 秒，环境因子检测间隔（perf: 5→10，天气变化缓慢无需高频）
+    static const float ENV_STATIC_BACKSTOP_INTERVAL = 60.0; // 秒，纪元/位置格/室内均未变且无湿重演化时的兜底重算间隔（云量、地表湿度缓变）
+    static const float ENV_LOCAL_INPUT_MIN_INTERVAL = 1.0; // 秒，本地输入变化触发重算的最小间隔（格边界抖动保护）
+    static const float ENV_INPUT_CELL_SIZE_M = 32.0; // 米，本地输入位置格边长（跨格即重算海拔/风阻等位置相关项）
     
     // 室内检测参数
     static const float ENV_INDOOR_CHECK_HEIGHT = 10.0; // 米，向上检测高度（判断是否有屋顶）
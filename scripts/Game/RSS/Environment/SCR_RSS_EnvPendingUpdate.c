@@ -1,37 +1,9 @@
-//! Pending force-update + weather snapshot sync (split from SCR_RSS_EnvironmentFactor.c)
+//! Pending force-update (split from SCR_RSS_EnvironmentFactor.c)
 
 class SCR_RSS_EnvPendingUpdate
 {
     protected static float s_fNextGlobalEnvLogTime = 0.0;
 
-    static void SyncWeatherCacheFromSnapshot(
-        RSS_WeatherSnapshot syncSnap,
-        inout float lastKnownTOD,
-        inout int lastKnownYear,
-        inout int lastKnownMonth,
-        inout int lastKnownDay,
-        inout float lastKnownRainIntensity,
-        inout float lastKnownWindSpeed,
-        inout bool lastKnownOverrideTemperature,
-        inout float lastKnownSunriseHour,
-        inout float lastKnownSunsetHour)
-    {
-        if (!syncSnap)
-            return;
-
-        lastKnownTOD = syncSnap.tod;
-        lastKnownYear = syncSnap.year;
-        lastKnownMonth = syncSnap.month;
-        lastKnownDay = syncSnap.day;
-        lastKnownRainIntensity = syncSnap.rainIntensity;
-        lastKnownWindSpeed = syncSnap.windSpeed;
-        lastKnownOverrideTemperature = syncSnap.overrideTemp;
-        if (syncSnap.hasSunrise)
-            lastKnownSunriseHour = syncSnap.sunriseHour;
-        if (syncSnap.hasSunset)
-            lastKnownSunsetHour = syncSnap.sunsetHour;
-    }
-
     static void ApplyPendingForceTemperature(
         TimeAndWeatherManagerEntity weatherManager,
         float latitude,
@@ -53,7 +25,7 @@ class SCR_RSS_EnvPendingUpdate
             int year, month, day;
             weatherManager.GetDate(year, month, day);
             int n = SCR_RSS_AstronomyMath.DayOfYear(year, month, day);
-            float T = SCR_RSS_AstronomyMath.CalculateUniversalTemperature(
+            float T = SCR_RSS_AstronomyDayTable.SampleUniversalTemperature(
                 latitude, n, tod, altM, cloud, rain, fogDensity);
             cachedSurfaceTemperature = T;
             cachedTemperature = cachedSurfaceTemperature;
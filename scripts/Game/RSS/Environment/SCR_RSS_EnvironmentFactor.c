@@ -30,16 +30,12 @@ class SCR_RSS_EnvironmentFactor
     protected float m_fLastRainIntensity = 0.0; // 上次检测到的降雨强度（用于衰减计算）
     protected IEntity m_pCachedOwner; // 缓存的角色实体引用（用于室内检测）
 
-    // 实时变更检测缓存（用于即时响应管理员修改）
-    protected float m_fLastKnownTOD = -1.0; // 上次记录的 GetTimeOfTheDay 值
-    protected int m_iLastKnownYear = -1;
-    protected int m_iLastKnownMonth = -1;
-    protected int m_iLastKnownDay = -1;
-    protected float m_fLastKnownRainIntensity = -1.0;
-    protected float m_fLastKnownWindSpeed = -1.0;
-    protected bool m_bLastKnownOverrideTemperature = false;
-    protected float m_fLastKnownSunriseHour = -1.0;
-    protected float m_fLastKnownSunsetHour = -1.0;
+    // 已应用的环境输入：全局天气纪元 + 本地位置格 / 室内状态（均未变则跳过重算）
+    protected int m_iAppliedEnvEpoch = -1;
+    protected int m_iAppliedEnvCellX = 0;
+    protected int m_iAppliedEnvCellZ = 0;
+    protected bool m_bAppliedEnvIndoor = false;
+    protected bool m_bEnvInputsApplied = false;
 
     protected float m_fCachedRainIntensity = 0.0; // 缓存的降雨强度（0.0-1.0）
     protected float m_fCachedWindSpeed = 0.0; // 缓存的风速（m/s）
@@ -88,8 +84,8 @@ class SCR_RSS_EnvironmentFactor
     protected float m_fSurfaceEmissivity = 0.98; // 地表发射率
     protected float m_fCachedSurfaceTemperature = 20.0; // 缓存的近地面温度（°C）
     
-    // 上次应用的配置版本（用于检测管理员实时修改，触发 ApplySettings）
-    protected static string s_lastAppliedConfigVersion = "";
+    // 上次应用的配置纪元（SCR_RSS_ConfigManager.GetConfigEpoch；不同则在下次更新时重新 ApplySettings）
+    protected int m_iAppliedConfigEpoch = -1;
 
     // 物理模型可调系数（可从 SCR_RSS_Settings 读取）
     protected float m_fCloudBlockingCoeff = 0.7; // 云层遮挡短波的系数（经验）
@@ -184,25 +180,9 @@ class SCR_RSS_EnvironmentFactor
                 m_fLatitude = engLat;
         }
 
-        // 初始化实时检测缓存（若引擎可用）
-        if (m_pCachedWeatherManager)
-        {
-            m_fLastKnownTOD = ReadSignalTOD();
-            int y, mo, d;
-            m_pCachedWeatherManager.GetDate(y, mo, d);
-            m_iLastKnownYear = y;
-            m_iLastKnownMonth = mo;
-            m_iLastKnownDay = d;
-            m_fLastKnownRainIntensity = ReadSignalRainIntensity();
-            m_fLastKnownWindSpeed = ReadSignalWindSpeed();
-            m_bLastKnownOverrideTemperature = m_pCachedWeatherManager.GetOverrideTemperature();
-            float sr = 0.0;
-            float ss = 0.0;
-            if (m_pCachedWeatherManager.GetSunriseHour(sr))
-                m_fLastKnownSunriseHour = sr;
-            if (m_pCachedWeatherManager.GetSunsetHour(ss))
-                m_fLastKnownSunsetHour = ss;
-        }
+        // 以当前纪元为基线：首次更新只因本地输入未记录而重算，不触发即时温度重算
+        m_iAppliedEnvEpoch = SCR_RSS_WeatherChangeDetector.GetEpoch();
+        m_bEnvInputsApplied = false;
         // 初始化 pending 标志
         m_bPendingForceUpdate = false;
         m_fNextForceUpdateLogTime = 0.0;
@@ -321,47 +301,60 @@ class SCR_RSS_EnvironmentFactor
             m_pCachedOwner = owner;
 
         // 按间隔更新室内状态缓存 — 委托给 m_pIndoorDetector
+        bool indoor = false;
         if (m_pIndoorDetector)
-            m_pIndoorDetector.UpdateIndoorCache(m_pCachedOwner, currentTime);
-        
-        bool forceUpdate = false;
+            indoor = m_pIndoorDetector.UpdateIndoorCache(m_pCachedOwner, currentTime);
+
+        // 天气/时间/温度覆盖变化由检测器每世界统一判定，这里只比较纪元
         if (m_pCachedWeatherManager)
         {
-            float currTOD = ReadSignalTOD();
-            float currRain = ReadSignalRainIntensity();
-            float currWind = ReadSignalWindSpeed();
-            RSS_WeatherSnapshot snap = SCR_RSS_WeatherChangeDetector.Sample(
-                m_pCachedWeatherManager, currTOD, currRain, currWind);
-            SCR_RSS_WeatherChangeDetector.LogEngineWeatherBatch(snap);
-            forceUpdate = SCR_RSS_WeatherChangeDetector.NeedsForceUpdate(
-                snap,
-                m_fLastKnownTOD,
-                m_iLastKnownYear,
-                m_iLastKnownMonth,
-                m_iLastKnownDay,
-                m_fLastKnownRainIntensity,
-                m_fLastKnownWindSpeed,
-                m_bLastKnownOverrideTemperature,
-                m_fLastKnownSunriseHour,
-                m_fLastKnownSunsetHour);
+            float nowMs = currentTime * 1000.0;
+            if (SCR_RSS_WeatherChangeDetector.IsPollDue(nowMs))
+                SCR_RSS_WeatherChangeDetector.Poll(
+                    nowMs, m_pCachedWeatherManager, ReadSignalTOD(), ReadSignalRainIntensity(), ReadSignalWindSpeed());
         }
+        int envEpoch = SCR_RSS_WeatherChangeDetector.GetEpoch();
+        bool forceUpdate = (envEpoch != m_iAppliedEnvEpoch);
 
-        // CRITICAL FIX: Check if RSS config has been reloaded (admin changed settings).
-        // ApplySettings() reads temperature/physics coefficients from SCR_RSS_Settings;
-        // without this periodic check, admin changes only take effect on entity re-initialization.
-        SCR_RSS_Settings rssSettings = SCR_RSS_ConfigManager.GetSettings();
-        if (rssSettings)
+        // 管理员改配置只递增全局纪元；本实体在此惰性重读温度/物理系数，并视同天气变化立即重算
+        if (m_iAppliedConfigEpoch != SCR_RSS_ConfigManager.GetConfigEpoch())
         {
-            string currentCfgVer = rssSettings.m_sConfigVersion;
-            if (currentCfgVer != s_lastAppliedConfigVersion)
-            {
-                ApplySettings();
-                s_lastAppliedConfigVersion = currentCfgVer;
-            }
+            ApplySettings();
+            forceUpdate = true;
         }
 
-        if (!forceUpdate && (currentTime - m_fLastEnvironmentCheckTime < SCR_RSS_EnvConstants.ENV_CHECK_INTERVAL))
-            return false;
+        int cellX = 0;
+        int cellZ = 0;
+        if (m_pCachedOwner)
+        {
+            vector pos = m_pCachedOwner.GetOrigin();
+            cellX = Math.Floor(pos[0] / SCR_RSS_EnvConstants.ENV_INPUT_CELL_SIZE_M);
+            cellZ = Math.Floor(pos[2] / SCR_RSS_EnvConstants.ENV_INPUT_CELL_SIZE_M);
+        }
+        float elapsedSinceCheck = currentTime - m_fLastEnvironmentCheckTime;
+        if (!forceUpdate)
+        {
+            // 本地输入变化（跨格 / 进出室内）至少间隔 ENV_LOCAL_INPUT_MIN_INTERVAL，避免在格边界抖动时逐 tick 重算
+            if (m_bEnvInputsApplied && elapsedSinceCheck < SCR_RSS_EnvConstants.ENV_LOCAL_INPUT_MIN_INTERVAL)
+                return false;
+        }
+        bool localInputsSame = m_bEnvInputsApplied && !forceUpdate
+            && cellX == m_iAppliedEnvCellX && cellZ == m_iAppliedEnvCellZ && indoor == m_bAppliedEnvIndoor;
+        if (localInputsSame)
+        {
+            // 输入未变：仅随时间演化的状态（降雨湿重累积/衰减、运动中的风阻）仍按常规间隔推进，其余走长兜底
+            if (elapsedSinceCheck < SCR_RSS_EnvConstants.ENV_CHECK_INTERVAL)
+                return false;
+            if (!HasTimeEvolvingEnvState(playerVelocity, swimmingWetWeight)
+                && elapsedSinceCheck < SCR_RSS_EnvConstants.ENV_STATIC_BACKSTOP_INTERVAL)
+                return false;
+        }
+
+        m_iAppliedEnvEpoch = envEpoch;
+        m_iAppliedEnvCellX = cellX;
+        m_iAppliedEnvCellZ = cellZ;
+        m_bAppliedEnvIndoor = indoor;
+        m_bEnvInputsApplied = true;
 
         // 标记为已检查时间
         m_fLastEnvironmentCheckTime = currentTime;
@@ -414,38 +407,6 @@ class SCR_RSS_EnvironmentFactor
             MarkPendingForceUpdate();
         }
 
-        if (m_pCachedWeatherManager)
-        {
-            RSS_WeatherSnapshot syncSnap = SCR_RSS_WeatherChangeDetector.Sample(
-                m_pCachedWeatherManager,
-                ReadSignalTOD(),
-                ReadSignalRainIntensity(),
-                ReadSignalWindSpeed());
-            float lastTOD = m_fLastKnownTOD;
-            int lastY = m_iLastKnownYear;
-            int lastMo = m_iLastKnownMonth;
-            int lastD = m_iLastKnownDay;
-            float lastRain = m_fLastKnownRainIntensity;
-            float lastWind = m_fLastKnownWindSpeed;
-            bool lastOverride = m_bLastKnownOverrideTemperature;
-            float lastSunrise = m_fLastKnownSunriseHour;
-            float lastSunset = m_fLastKnownSunsetHour;
-            SCR_RSS_EnvPendingUpdate.SyncWeatherCacheFromSnapshot(
-                syncSnap,
-                lastTOD, lastY, lastMo, lastD,
-                lastRain, lastWind, lastOverride,
-                lastSunrise, lastSunset);
-            m_fLastKnownTOD = lastTOD;
-            m_iLastKnownYear = lastY;
-            m_iLastKnownMonth = lastMo;
-            m_iLastKnownDay = lastD;
-            m_fLastKnownRainIntensity = lastRain;
-            m_fLastKnownWindSpeed = lastWind;
-            m_bLastKnownOverrideTemperature = lastOverride;
-            m_fLastKnownSunriseHour = lastSunrise;
-            m_fLastKnownSunsetHour = lastSunset;
-        }
-
         bool pendingForce = m_bPendingForceUpdate;
         float surfaceTemp = m_fCachedSurfaceTemperature;
         float cachedTemp = m_fCachedTemperature;
@@ -809,6 +770,7 @@ class SCR_RSS_EnvironmentFactor
     protected void ApplySettings()
     {
         SCR_RSS_Settings settings = SCR_RSS_ConfigManager.GetSettings();
+        m_iAppliedConfigEpoch = SCR_RSS_ConfigManager.GetConfigEpoch();
         if (!settings)
             return;
 
@@ -831,7 +793,7 @@ class SCR_RSS_EnvironmentFactor
             m_fLongitude = m_pCachedWeatherManager.GetCurrentLongitude();
     }
 
-    // 外部调用：在配置发生改变时调用以立即应用新设置
+    // 外部调用：立即应用新设置（常规路径无需调用，UpdateEnvironmentFactors 按配置纪元自动重读）
     void OnConfigUpdated()
     {
         ApplySettings();
@@ -987,6 +949,16 @@ class SCR_RSS_EnvironmentFactor
         return ReadSignalWetness();
     }
     
+    //! 输入不变时仍需按常规间隔推进的状态：降雨/干燥中的湿重、游泳湿重、运动中的风阻
+    protected bool HasTimeEvolvingEnvState(vector playerVelocity, float swimmingWetWeight)
+    {
+        if (m_fCachedRainWeight > 0.0 || swimmingWetWeight > 0.0 || m_fCurrentTotalWetWeight > 0.0)
+            return true;
+        if (m_fCachedRainIntensity > SCR_RSS_EnvConstants.ENV_RAIN_INTENSITY_THRESHOLD)
+            return true;
+        return m_fCachedWindSpeed > 0.0 && playerVelocity.LengthSq() > 0.01;
+    }
+
     // 降雨中：按强度非线性累积；停雨后：指数衰减（τ≈60s，湿重<0.1kg 归零）
     protected void CalculateRainWetWeight(float currentTime)
     {
@@ -1087,16 +1059,9 @@ class SCR_RSS_EnvironmentFactor
         m_fLastCloudFactorUpdateTime = -999.0;
         m_bTempPositionInitialized = false;
 
-        // 重置实时变更检测缓存，避免与旧世界的缓存值进行差异比较
-        m_fLastKnownTOD = -1.0;
-        m_iLastKnownYear = -1;
-        m_iLastKnownMonth = -1;
-        m_iLastKnownDay = -1;
-        m_fLastKnownRainIntensity = -1.0;
-        m_fLastKnownWindSpeed = -1.0;
-        m_bLastKnownOverrideTemperature = false;
-        m_fLastKnownSunriseHour = -1.0;
-        m_fLastKnownSunsetHour = -1.0;
+        // 本地输入记录作废：新世界首次更新必定重算
+        m_iAppliedEnvEpoch = SCR_RSS_WeatherChangeDetector.GetEpoch();
+        m_bEnvInputsApplied = false;
     }
 
     //! 新 GameMode / 世界开始时调用（由 SCR_BaseGameMode::OnGameStart 触发）。
@@ -25,7 +25,7 @@ class SCR_RSS_TemperatureSampler
 
         if (lastTemperatureUpdateTime <= 0.0 && cachedSurfaceTemperature == 20.0)
         {
-            cachedSurfaceTemperature = SCR_RSS_AstronomyMath.CalculateUniversalTemperature(
+            cachedSurfaceTemperature = SCR_RSS_AstronomyDayTable.SampleUniversalTemperature(
                 lat, dayOfYear, tod, altM, cloud, rain, fogDensity);
             lastTemperatureUpdateTime = currentTime;
             if (owner)
@@ -47,7 +47,7 @@ class SCR_RSS_TemperatureSampler
 
         if (timeTrigger || posTrigger)
         {
-            cachedSurfaceTemperature = SCR_RSS_AstronomyMath.CalculateUniversalTemperature(
+            cachedSurfaceTemperature = SCR_RSS_AstronomyDayTable.SampleUniversalTemperature(
                 lat, dayOfYear, tod, altM, cloud, rain, fogDensity);
             lastTemperatureUpdateTime = currentTime;
             nextTempStepLogTime = currentTime + tempUpdateInterval;
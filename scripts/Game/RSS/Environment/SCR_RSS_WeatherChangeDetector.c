@@ -1,4 +1,8 @@
 //! 引擎天气变更检测（从 SCR_RSS_EnvironmentFactor.c 拆分）
+//!
+//! 每个世界只有一份检测状态：首个到期的环境更新调用 Poll，至多每 POLL_INTERVAL_MS 采样一次引擎天气，
+//! 与上次快照比较（NeedsForceUpdate 同一组阈值）；有变化则递增全局环境纪元并通知订阅者。
+//! 各实体只比较自己应用过的纪元，不再各自采样/保存 m_fLastKnown* 副本。
 
 class RSS_WeatherSnapshot
 {
@@ -17,6 +21,88 @@ class RSS_WeatherSnapshot
 
 class SCR_RSS_WeatherChangeDetector
 {
+    //! 全局采样周期（世界时间 ms）；管理员改天气/时间的响应延迟上限
+    static const float POLL_INTERVAL_MS = 500.0;
+
+    protected static World s_pWorld;
+    protected static float s_fLastPollMs = -1.0;
+    protected static int s_iEnvEpoch = 0;
+    protected static ref RSS_WeatherSnapshot s_pLastSnapshot;
+    protected static ref ScriptInvoker s_OnEnvironmentChanged;
+
+    //! 当前环境纪元；天气/时间/温度覆盖变化（或 BumpEpoch）时递增
+    static int GetEpoch()
+    {
+        return s_iEnvEpoch;
+    }
+
+    //! 纪元变化事件（无参数，订阅者自行读取 GetEpoch）；首次调用时创建
+    static ScriptInvoker GetOnEnvironmentChanged()
+    {
+        if (!s_OnEnvironmentChanged)
+            s_OnEnvironmentChanged = new ScriptInvoker();
+        return s_OnEnvironmentChanged;
+    }
+
+    //! 本世界是否到了下一次采样；世界切换时丢弃旧快照（纪元继续递增，旧实体的记录自然失效）
+    static bool IsPollDue(float nowMs)
+    {
+        World world = null;
+        if (GetGame())
+            world = GetGame().GetWorld();
+        if (world != s_pWorld)
+        {
+            s_pWorld = world;
+            s_pLastSnapshot = null;
+            s_fLastPollMs = -1.0;
+        }
+        return s_fLastPollMs < 0.0 || nowMs - s_fLastPollMs >= POLL_INTERVAL_MS || nowMs < s_fLastPollMs;
+    }
+
+    //! 采样并与上次快照比较；首次采样只记录基线，不递增纪元。返回当前纪元
+    static int Poll(
+        float nowMs,
+        TimeAndWeatherManagerEntity weatherManager,
+        float tod,
+        float rainIntensity,
+        float windSpeed)
+    {
+        s_fLastPollMs = nowMs;
+        if (!weatherManager)
+            return s_iEnvEpoch;
+
+        RSS_WeatherSnapshot snap = Sample(weatherManager, tod, rainIntensity, windSpeed);
+        LogEngineWeatherBatch(snap);
+        if (!s_pLastSnapshot)
+        {
+            s_pLastSnapshot = snap;
+            return s_iEnvEpoch;
+        }
+
+        RSS_WeatherSnapshot last = s_pLastSnapshot;
+        float lastSunrise = -1.0;
+        float lastSunset = -1.0;
+        if (last.hasSunrise)
+            lastSunrise = last.sunriseHour;
+        if (last.hasSunset)
+            lastSunset = last.sunsetHour;
+        if (NeedsForceUpdate(snap, last.tod, last.year, last.month, last.day,
+            last.rainIntensity, last.windSpeed, last.overrideTemp, lastSunrise, lastSunset))
+        {
+            s_pLastSnapshot = snap;
+            BumpEpoch();
+        }
+        return s_iEnvEpoch;
+    }
+
+    //! 非引擎天气来源（如配置）改变环境输入时手动递增
+    static void BumpEpoch()
+    {
+        s_iEnvEpoch++;
+        if (s_OnEnvironmentChanged)
+            s_OnEnvironmentChanged.Invoke();
+    }
+
     //! 采样当前引擎天气到快照
     static RSS_WeatherSnapshot Sample(
         TimeAndWeatherManagerEntity weatherManager,
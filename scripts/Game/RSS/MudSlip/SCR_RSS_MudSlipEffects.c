@@ -1,11 +1,17 @@
-// 泥泞滑倒：摩擦力阈值模型（RCOF > ACOF）+ Poisson 过程；环境门槛与 CalculateSlipRisk 一致
+// 泥泞滑倒：摩擦力阈值模型（RCOF > ACOF）+ Poisson 过程（事件率 λ；等待时间抽样见 SCR_RSS_MudSlipRunner）
 // RCOF 额外含：有符号坡度（下坡加权）、急转 min(ω·v·k, T_max)、低体力平衡惩罚、落地/起跳蹬地
 
 class SCR_RSS_MudSlipEffects
 {
-    protected const float M_EULER = 2.718281828459045;
+    static const float M_EULER = 2.718281828459045;
 
-    // @param env 已 UpdateEnvironmentFactors 后的环境模块
+    //! 掷骰路径单步概率上限 0.6 对应的单步暴露量上限：-ln(0.4)
+    static const float MAX_STEP_HAZARD = 0.916291;
+
+    // 滑倒事件率 λ（1/s）：gap 超过 ε_dice 后线性于 gap；低体力平衡抖动 U·kσ·(1−s) 对 U 解析取期望，
+    // 逐帧不再取随机数（Runner 以指数等待时间累积 λ·Δt 决定何时滑倒）
+    // @param acof ComputeAvailableCof(env)，地形/泥泞度变化时由 Runner 预计算
+    // @param lambdaPerGap ComputeLambdaPerGap(env)，同上
     // @param horizontalSpeed 水平速度 m/s
     // @param isSprinting 是否处于冲刺相
     // @param encumbranceKg 当前负重 kg（装备，不含身体）
@@ -13,11 +19,9 @@ class SCR_RSS_MudSlipEffects
     // @param slopeAngleDegreesSigned SCR_RSS_SpeedCalculator：正=上坡，负=下坡
     // @param turnRateRadPerSec 水平速度方向变化率（rad/s），由 PlayerBase 两帧水平向夹角/Δt
     // @param staminaPercent 当前目标体力 0~1，低体力提高 RCOF
-    // @param deltaTimeSec 本帧时间步长（秒）
-    // @param currentWorldTime 世界时间（秒）
-    // @param cooldownAnchorTime 9s 冷却起点（秒）；<0 表示尚未锚定（滑倒后未从趴起身则不计时）
-    static bool TryRollMudSlip(
-        SCR_RSS_EnvironmentFactor env,
+    static float ComputeSlipHazardPerSec(
+        float acof,
+        float lambdaPerGap,
         float horizontalSpeed,
         bool isSprinting,
         float encumbranceKg,
@@ -26,27 +30,13 @@ class SCR_RSS_MudSlipEffects
         float turnRateRadPerSec,
         float staminaPercent,
         float verticalVelocityY,
-        float prevVerticalVelocityY,
-        float deltaTimeSec,
-        float currentWorldTime,
-        float cooldownAnchorTime)
+        float prevVerticalVelocityY)
     {
-        if (!env)
-            return false;
-        if (!SCR_RSS_ConfigBridge.IsMudPenaltyEnabled())
-            return false;
-        if (env.GetSlipRisk() <= 0.0)
-            return false;
-        if (cooldownAnchorTime >= 0.0)
-        {
-            if (currentWorldTime - cooldownAnchorTime < SCR_RSS_EnvConstants.ENV_MUD_SLIP_COOLDOWN_SEC)
-                return false;
-        }
-
+        if (lambdaPerGap <= 0.0)
+            return 0.0;
         if (horizontalSpeed < SCR_RSS_EnvConstants.ENV_MUD_SLIP_MIN_SPEED_MS)
-            return false;
+            return 0.0;
 
-        float acof = ComputeAvailableCof(env);
         float rcof = ComputeRequiredCof(
             horizontalSpeed,
             isSprinting,
@@ -56,28 +46,33 @@ class SCR_RSS_MudSlipEffects
             turnRateRadPerSec,
             staminaPercent,
             verticalVelocityY,
-            prevVerticalVelocityY,
-            true);
+            prevVerticalVelocityY);
         float gap = rcof - acof;
-        if (gap <= SCR_RSS_EnvConstants.ENV_SLIP_GAP_EPSILON_DICE)
-            return false;
+        float eps = SCR_RSS_EnvConstants.ENV_SLIP_GAP_EPSILON_DICE;
 
-        float lambda = ComputeLambdaFromGap(gap, env);
-        if (lambda <= 0.0)
-            return false;
+        float staminaDeficit = 1.0 - Math.Clamp(staminaPercent, 0.0, 1.0);
+        float jitter = 0.0;
+        if (staminaDeficit > 0.01)
+            jitter = SCR_RSS_EnvConstants.ENV_SLIP_RCOF_BALANCE_JITTER * staminaDeficit;
 
-        float exponent = -lambda * deltaTimeSec;
-        float prob = 1.0 - Math.Pow(M_EULER, exponent);
-        if (prob > 0.6)
-            prob = 0.6;
+        if (jitter <= 0.0)
+        {
+            if (gap <= eps)
+                return 0.0;
+            return lambdaPerGap * gap;
+        }
 
-        return Math.RandomFloat01() < prob;
+        // E_U[λ] = k·∫_{u0}^{1} (gap + jitter·u) du，u0 为越过 ε_dice 的最小 U
+        float u0 = Math.Clamp((eps - gap) / jitter, 0.0, 1.0);
+        return lambdaPerGap * ((1.0 - u0) * gap + 0.5 * jitter * (1.0 - u0 * u0));
     }
 
     // 泥泞失稳镜头预警：与滑倒同一套 ACOF/RCOF，但 RCOF 不含低体力随机抖动，避免画面高频跳变
+    // 环境门槛（泥泞开关、GetSlipRisk）由 Runner 在调用前判定
+    // @param acof ComputeAvailableCof(env)
     // @return 0~1，供第一人称摄像机叠加角抖动强度
     static float ComputeSlipCameraStress01(
-        SCR_RSS_EnvironmentFactor env,
+        float acof,
         float horizontalSpeed,
         bool isSprinting,
         float encumbranceKg,
@@ -88,16 +83,9 @@ class SCR_RSS_MudSlipEffects
         float verticalVelocityY,
         float prevVerticalVelocityY)
     {
-        if (!env)
-            return 0.0;
-        if (!SCR_RSS_ConfigBridge.IsMudPenaltyEnabled())
-            return 0.0;
-        if (env.GetSlipRisk() <= 0.0)
-            return 0.0;
         if (horizontalSpeed < SCR_RSS_EnvConstants.ENV_MUD_SLIP_MIN_SPEED_MS)
             return 0.0;
 
-        float acof = ComputeAvailableCof(env);
         float rcof = ComputeRequiredCof(
             horizontalSpeed,
             isSprinting,
@@ -107,8 +95,7 @@ class SCR_RSS_MudSlipEffects
             turnRateRadPerSec,
             staminaPercent,
             verticalVelocityY,
-            prevVerticalVelocityY,
-            false);
+            prevVerticalVelocityY);
         float gap = rcof - acof;
         float epsCam = SCR_RSS_EnvConstants.ENV_SLIP_GAP_EPSILON_CAMERA;
         float thrFat = SCR_RSS_EnvConstants.ENV_MUD_SLIP_CAM_SHAKE_FATIGUE_STAMINA_THRESHOLD;
@@ -139,7 +126,7 @@ class SCR_RSS_MudSlipEffects
     }
 
     // 可用摩擦：干燥材质基线 ×（1 − 泥泞润滑）；越野略降干摩擦上界
-    protected static float ComputeAvailableCof(SCR_RSS_EnvironmentFactor env)
+    static float ComputeAvailableCof(SCR_RSS_EnvironmentFactor env)
     {
         float eta = env.GetCachedTerrainFactor();
         float mud = env.GetMudFactor();
@@ -165,6 +152,7 @@ class SCR_RSS_MudSlipEffects
     }
 
     // 所需摩擦：基线 + 与 (v−v_min)² 成正比的剪切需求 + 冲刺 + 负重；蹲姿缩放
+    // 低体力随机抖动不在此处取样：滑倒路径在 ComputeSlipHazardPerSec 中对其取期望
     protected static float ComputeRequiredCof(
         float horizontalSpeed,
         bool isSprinting,
@@ -174,8 +162,7 @@ class SCR_RSS_MudSlipEffects
         float turnRateRadPerSec,
         float staminaPercent,
         float verticalVelocityY,
-        float prevVerticalVelocityY,
-        bool applyBalanceJitter)
+        float prevVerticalVelocityY)
     {
         float vmin = SCR_RSS_EnvConstants.ENV_MUD_SLIP_MIN_SPEED_MS;
         float ex = horizontalSpeed - vmin;
@@ -228,11 +215,6 @@ class SCR_RSS_MudSlipEffects
             st = 1.0;
         float staminaDeficit = 1.0 - st;
         rcof = rcof + SCR_RSS_EnvConstants.ENV_SLIP_RCOF_BALANCE_STAMINA * staminaDeficit;
-        if (applyBalanceJitter)
-        {
-            if (staminaDeficit > 0.01)
-                rcof = rcof + Math.RandomFloat01() * SCR_RSS_EnvConstants.ENV_SLIP_RCOF_BALANCE_JITTER * staminaDeficit;
-        }
 
         if (prevVerticalVelocityY < SCR_RSS_EnvConstants.ENV_SLIP_LANDING_VY_PREV)
         {
@@ -246,16 +228,12 @@ class SCR_RSS_MudSlipEffects
         return rcof;
     }
 
-    // 缺口 → 事件率：λ∝gap（线性），大缺口时比 gap² 更平缓；越野泥泞略增
-    protected static float ComputeLambdaFromGap(float gap, SCR_RSS_EnvironmentFactor env)
+    // 缺口 → 事件率的斜率：λ = k·gap（线性），大缺口时比 gap² 更平缓；越野泥泞略增
+    static float ComputeLambdaPerGap(SCR_RSS_EnvironmentFactor env)
     {
-        float g = gap;
-        if (g < 0.0)
-            g = 0.0;
-        float lambda = SCR_RSS_EnvConstants.ENV_MUD_SLIP_PHYS_SCALE * g;
-        lambda = lambda * SCR_RSS_EnvConstants.ENV_MUD_SLIP_GLOBAL_SCALE;
+        float k = SCR_RSS_EnvConstants.ENV_MUD_SLIP_PHYS_SCALE * SCR_RSS_EnvConstants.ENV_MUD_SLIP_GLOBAL_SCALE;
         if (env.GetMudTerrainFactor() > 0.0)
-            lambda = lambda * 1.18;
-        return lambda;
+            k = k * 1.18;
+        return k;
     }
 }
@@ -13,6 +13,17 @@ class SCR_RSS_MudSlipRunner
     protected float m_fPrevVerticalVelocityY = 0.0;
     protected vector m_vLastHorizontalVelocity = vector.Zero;
 
+    // 指数等待时间：抽一次 U，累积生存概率 exp(-∫λdt)，降到 U 以下即滑倒；<0 表示尚未抽取
+    protected float m_fSlipSurvival = 1.0;
+    protected float m_fSlipThresholdU = -1.0;
+
+    // 地形/泥泞度决定的危险常量（ACOF、λ/gap），仅在输入变化时重算
+    protected float m_fHazardKeyTerrain = -1.0;
+    protected float m_fHazardKeyMud = -1.0;
+    protected bool m_bHazardKeyMudTerrain = false;
+    protected float m_fHazardAcof = 0.0;
+    protected float m_fHazardLambdaPerGap = 0.0;
+
     // 在 CalculateGradePercent 之后调用；内部更新上一帧水平/垂向速度供下帧使用
     void ProcessAfterSlope(
         SCR_CharacterControllerComponent ctrl,
@@ -33,12 +44,23 @@ class SCR_RSS_MudSlipRunner
         if (!ctrl)
             return;
 
+        // 干燥地面（泥泞度低于门槛）或低于滑倒速度：gap 无从产生，跳过转向率、镜头应力与滑倒累积
+        bool slipSurface = false;
+        if (!useSwimmingModel && !isSwimming && env && stamina)
+        {
+            if (SCR_RSS_ConfigBridge.IsMudPenaltyEnabled() && env.GetSlipRisk() > 0.0)
+                slipSurface = true;
+        }
+        bool evaluateSlip = slipSurface && currentSpeed >= SCR_RSS_EnvConstants.ENV_MUD_SLIP_MIN_SPEED_MS;
+        if (evaluateSlip)
+            RefreshHazardConstants(env);
+
         vector horizontalVelForSlip = velocity;
         horizontalVelForSlip[1] = 0.0;
         float turnRateRadPerSec = 0.0;
         float hLenSlip = horizontalVelForSlip.Length();
         float lastHLenSlip = m_vLastHorizontalVelocity.Length();
-        if (hLenSlip > SCR_RSS_EnvConstants.ENV_SLIP_TURN_MIN_HORIZ_MS)
+        if (evaluateSlip && hLenSlip > SCR_RSS_EnvConstants.ENV_SLIP_TURN_MIN_HORIZ_MS)
         {
             if (lastHLenSlip > SCR_RSS_EnvConstants.ENV_SLIP_TURN_MIN_HORIZ_MS)
             {
@@ -111,10 +133,10 @@ class SCR_RSS_MudSlipRunner
                 float vySlip = velocity[1];
 
                 float camStress = 0.0;
-                if (!ctrl.RSS_IsRagdollActiveForCamera())
+                if (evaluateSlip && !ctrl.RSS_IsRagdollActiveForCamera())
                 {
                     camStress = SCR_RSS_MudSlipEffects.ComputeSlipCameraStress01(
-                        env,
+                        m_fHazardAcof,
                         currentSpeed,
                         isSprintActive,
                         currentWeight,
@@ -127,39 +149,35 @@ class SCR_RSS_MudSlipRunner
                 }
                 ctrl.RSS_SetMudSlipCameraShake01(camStress);
 
-                // 布娃娃进行中不掷骰；滑倒后须先趴起锚定冷却，未锚定前禁止再次掷骰
-                // AI 安全：本分支不调用 TryRoll（泥泞滑倒完全禁用，非靠压速间接避免）
-                IEntity slipOwner = ctrl.GetOwner();
-                bool allowMudSlipRoll = ctrl.RSS_ShouldAiAllowMudSlipRagdoll(slipOwner);
-                if (allowMudSlipRoll && !ctrl.RSS_IsRagdollActiveForCamera())
+                // 布娃娃进行中不累积；滑倒后须先趴起锚定冷却，未锚定前及冷却内不累积
+                // AI 安全：本分支不累积滑倒（泥泞滑倒完全禁用，非靠压速间接避免）
+                if (evaluateSlip && !m_bMudSlipAwaitCooldownAnchor && IsCooldownElapsed(currentWorldTime)
+                    && !ctrl.RSS_IsRagdollActiveForCamera()
+                    && ctrl.RSS_ShouldAiAllowMudSlipRagdoll(ctrl.GetOwner()))
                 {
-                    if (!m_bMudSlipAwaitCooldownAnchor)
+                    float hazardPerSec = SCR_RSS_MudSlipEffects.ComputeSlipHazardPerSec(
+                        m_fHazardAcof,
+                        m_fHazardLambdaPerGap,
+                        currentSpeed,
+                        isSprintActive,
+                        currentWeight,
+                        slipCrouch,
+                        slopeAngleDegrees,
+                        turnRateRadPerSec,
+                        staminaPercent,
+                        vySlip,
+                        m_fPrevVerticalVelocityY);
+                    if (AccumulateSlipExposure(hazardPerSec * timeDeltaSec))
                     {
-                        if (SCR_RSS_MudSlipEffects.TryRollMudSlip(
-                            env,
-                            currentSpeed,
-                            isSprintActive,
-                            currentWeight,
-                            slipCrouch,
-                            slopeAngleDegrees,
-                            turnRateRadPerSec,
-                            staminaPercent,
-                            vySlip,
-                            m_fPrevVerticalVelocityY,
-                            timeDeltaSec,
-                            currentWorldTime,
-                            m_fMudSlipCooldownAnchorTime))
-                        {
-                            m_fMudSlipEventWorldTime = currentWorldTime;
-                            m_bMudSlipAwaitCooldownAnchor = true;
-                            float stmBefore = stamina.GetTargetStamina();
-                            float stmAfter = stmBefore - SCR_RSS_EnvConstants.ENV_MUD_SLIP_STAMINA_FRAC;
-                            stmAfter = Math.Clamp(stmAfter, 0.0, 1.0);
-                            stamina.SetTargetStamina(stmAfter);
-                            ctrl.RSS_TriggerMudSlipRagdoll();
-                            if (rssDebug)
-                                Print("[RSS] 泥泞滑倒 / Mud slip: ragdoll + stamina drain");
-                        }
+                        m_fMudSlipEventWorldTime = currentWorldTime;
+                        m_bMudSlipAwaitCooldownAnchor = true;
+                        float stmBefore = stamina.GetTargetStamina();
+                        float stmAfter = stmBefore - SCR_RSS_EnvConstants.ENV_MUD_SLIP_STAMINA_FRAC;
+                        stmAfter = Math.Clamp(stmAfter, 0.0, 1.0);
+                        stamina.SetTargetStamina(stmAfter);
+                        ctrl.RSS_TriggerMudSlipRagdoll();
+                        if (rssDebug)
+                            Print("[RSS] 泥泞滑倒 / Mud slip: ragdoll + stamina drain");
                     }
                 }
                 m_fPrevVerticalVelocityY = vySlip;
@@ -186,4 +204,50 @@ class SCR_RSS_MudSlipRunner
         else
             m_vLastHorizontalVelocity = horizontalVelForSlip;
     }
-}
+
+    // 冷却锚定后须满 ENV_MUD_SLIP_COOLDOWN_SEC；从未滑倒（锚定 <0）时不受限
+    protected bool IsCooldownElapsed(float currentWorldTime)
+    {
+        if (m_fMudSlipCooldownAnchorTime < 0.0)
+            return true;
+        return currentWorldTime - m_fMudSlipCooldownAnchorTime >= SCR_RSS_EnvConstants.ENV_MUD_SLIP_COOLDOWN_SEC;
+    }
+
+    // 地形系数、泥泞度或越野泥泞标志变化时重算 ACOF 与 λ/gap
+    protected void RefreshHazardConstants(SCR_RSS_EnvironmentFactor env)
+    {
+        float terrain = env.GetCachedTerrainFactor();
+        float mud = env.GetMudFactor();
+        bool mudTerrain = env.GetMudTerrainFactor() > 0.0;
+        if (terrain == m_fHazardKeyTerrain && mud == m_fHazardKeyMud && mudTerrain == m_bHazardKeyMudTerrain)
+            return;
+
+        m_fHazardKeyTerrain = terrain;
+        m_fHazardKeyMud = mud;
+        m_bHazardKeyMudTerrain = mudTerrain;
+        m_fHazardAcof = SCR_RSS_MudSlipEffects.ComputeAvailableCof(env);
+        m_fHazardLambdaPerGap = SCR_RSS_MudSlipEffects.ComputeLambdaPerGap(env);
+    }
+
+    // 非齐次泊松过程的等待时间：累积暴露 H=∫λdt，生存 exp(-H) 低于预抽的 U 时事件发生。
+    // 与逐帧 P=1-exp(-λΔt) 掷骰同分布（单步暴露按原 P≤0.6 截断），但每次滑倒只取一次随机数。
+    // @return true 表示本步滑倒（随后重新抽取）
+    protected bool AccumulateSlipExposure(float exposure)
+    {
+        if (exposure <= 0.0)
+            return false;
+        if (exposure > SCR_RSS_MudSlipEffects.MAX_STEP_HAZARD)
+            exposure = SCR_RSS_MudSlipEffects.MAX_STEP_HAZARD;
+
+        if (m_fSlipThresholdU < 0.0)
+            m_fSlipThresholdU = Math.Max(Math.RandomFloat01(), 0.000001);
+
+        m_fSlipSurvival = m_fSlipSurvival * Math.Pow(SCR_RSS_MudSlipEffects.M_EULER, -exposure);
+        if (m_fSlipSurvival > m_fSlipThresholdU)
+            return false;
+
+        m_fSlipSurvival = 1.0;
+        m_fSlipThresholdU = -1.0;
+        return true;
+    }
+}
\ No newline at end of file
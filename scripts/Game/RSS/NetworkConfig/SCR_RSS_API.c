@@ -1,6 +1,8 @@
 // Realistic Stamina System (RSS) - 外部模组 API
 // 供其他模组获取玩家体力状态与环境信息
 // 用法：SCR_RSS_API.GetPlayerInfo(entity) / SCR_RSS_API.GetEnvironmentInfo(entity)
+//       SCR_RSS_API.GetAllManagedSnapshots(snapshots) 一次遍历全部受管实体
+// 返回对象为每实体快照（控制器持有），同一 tick 内重复调用直接返回，不重新查询；调用方只读、勿修改
 
 // ==================== 玩家信息结构体 ====================
 class RSS_PlayerInfo
@@ -19,6 +21,8 @@ class RSS_PlayerInfo
     float wPrimeMaxJoules;    // 当前预设 W′_max 焦耳
     float sprintCooldownRemainingSec; // 冲刺/爆发冷却剩余秒（多为 0；门禁以 W′ 施密特为主）
     bool sprintAllowed;       // 当前是否允许冲刺（CP/W′ 门禁）
+    float netStaminaRatePerSec; // 上一 tick 体力净变化率 (/s，恢复−消耗；不含超速税)
+    int tickId;                // 生成该快照时的 RSS tick 号
     bool isValid;              // 数据是否有效（实体有 RSS 组件且已初始化）
 }
 
@@ -35,14 +39,39 @@ class RSS_EnvironmentInfo
     float heatStressMultiplier;   // 热应激倍数
     float heatStressPenalty;      // 热应激惩罚
     float coldStressPenalty;     // 冷应激惩罚
+    int tickId;               // 生成该快照时的 RSS tick 号
     bool isValid;             // 数据是否有效
 }
 
+// ==================== 每实体快照 ====================
+// 控制器持有；stamp 为内部去重键（本地有 tick 时 = tick 号，否则按世界时毫秒）
+class RSS_EntitySnapshot
+{
+    IEntity entity;
+    ref RSS_PlayerInfo player;
+    ref RSS_EnvironmentInfo environment;
+    int playerStamp = int.MIN;
+    int environmentStamp = int.MIN;
+
+    void RSS_EntitySnapshot()
+    {
+        player = new RSS_PlayerInfo();
+        environment = new RSS_EnvironmentInfo();
+    }
+
+    // 强制下次读取时重新生成（如导出前刷新了环境因子）
+    void Invalidate()
+    {
+        playerStamp = int.MIN;
+        environmentStamp = int.MIN;
+    }
+}
+
 // ==================== RSS API 静态类 ====================
 class SCR_RSS_API
 {
-    protected static ref RSS_PlayerInfo s_pPlayerInfoCache;
-    protected static ref RSS_EnvironmentInfo s_pEnvInfoCache;
+    // 受管控制器登记（OnInit 登记、删除时注销；非 ref，实体销毁后自动置空）
+    protected static ref array<SCR_CharacterControllerComponent> s_aManagedControllers;
 
     // 获取 RSS 控制的角色控制器组件（供高级用法）
     // @param entity 角色实体（IEntity，通常为 ChimeraCharacter）
@@ -56,103 +85,70 @@ class SCR_RSS_API
 
     // 获取玩家当前体力与运动状态
     // @param entity 角色实体
-    // @return RSS_PlayerInfo，若无效则 isValid=false
+    // @return RSS_PlayerInfo，若无效则 isValid=false（无效时每次新建，不与其他调用方共享）
     static RSS_PlayerInfo GetPlayerInfo(IEntity entity)
     {
-        if (!s_pPlayerInfoCache)
-            s_pPlayerInfoCache = new RSS_PlayerInfo();
-
-        s_pPlayerInfoCache.staminaPercent = 0.0;
-        s_pPlayerInfoCache.speedMultiplier = 1.0;
-        s_pPlayerInfoCache.currentSpeed = 0.0;
-        s_pPlayerInfoCache.movementPhase = 0;
-        s_pPlayerInfoCache.isSprinting = false;
-        s_pPlayerInfoCache.isExhausted = false;
-        s_pPlayerInfoCache.isSwimming = false;
-        s_pPlayerInfoCache.currentWeight = 0.0;
-        s_pPlayerInfoCache.anaerobicPercent = 0.0;
-        s_pPlayerInfoCache.wPrimePool01 = 0.0;
-        s_pPlayerInfoCache.wPrimeJoules = 0.0;
-        s_pPlayerInfoCache.wPrimeMaxJoules = 0.0;
-        s_pPlayerInfoCache.sprintCooldownRemainingSec = 0.0;
-        s_pPlayerInfoCache.sprintAllowed = false;
-        s_pPlayerInfoCache.isValid = false;
-
         SCR_CharacterControllerComponent ctrl = GetRssController(entity);
-        if (!ctrl)
-            return s_pPlayerInfoCache;
-
-        if (!ctrl.HasRssData())
-            return s_pPlayerInfoCache;
-
-        s_pPlayerInfoCache.staminaPercent = ctrl.GetRssStaminaPercent();
-        s_pPlayerInfoCache.speedMultiplier = ctrl.GetRssSpeedMultiplier();
-        s_pPlayerInfoCache.currentSpeed = ctrl.GetRssCurrentSpeed();
-        s_pPlayerInfoCache.movementPhase = ctrl.GetRssMovementPhase();
-        s_pPlayerInfoCache.isSprinting = ctrl.GetRssIsSprinting();
-        s_pPlayerInfoCache.isExhausted = ctrl.GetRssIsExhausted();
-        s_pPlayerInfoCache.isSwimming = ctrl.GetRssIsSwimming();
-        s_pPlayerInfoCache.currentWeight = ctrl.GetRssCurrentWeight();
-        s_pPlayerInfoCache.wPrimePool01 = ctrl.GetRssWPrimePool01();
-        s_pPlayerInfoCache.anaerobicPercent = s_pPlayerInfoCache.wPrimePool01;
-        s_pPlayerInfoCache.wPrimeMaxJoules = SCR_RSS_ConfigBridge.GetWPrimeMaxJoules();
-        SCR_RSS_AnaerobicBurst burst = ctrl.RSS_GetWPrimeBurst();
-        if (burst)
-        {
-            s_pPlayerInfoCache.wPrimeJoules = burst.GetWPrimeJoules();
-        }
-        else
-        {
-            s_pPlayerInfoCache.wPrimeJoules = s_pPlayerInfoCache.wPrimePool01 * s_pPlayerInfoCache.wPrimeMaxJoules;
-        }
-        s_pPlayerInfoCache.sprintCooldownRemainingSec = ctrl.GetRssSprintCooldownRemainingSec();
-        s_pPlayerInfoCache.sprintAllowed = ctrl.GetRssSprintAllowed();
-        s_pPlayerInfoCache.isValid = true;
+        if (!ctrl || !ctrl.HasRssData())
+            return NewInvalidPlayerInfo();
 
-        return s_pPlayerInfoCache;
+        RSS_EntitySnapshot snapshot = ctrl.RSS_GetApiSnapshot();
+        RefreshPlayerInfo(ctrl, snapshot);
+        return snapshot.player;
     }
 
     // 获取角色所在位置的环境信息
     // @param entity 角色实体（用于室内检测与位置相关环境）
-    // @return RSS_EnvironmentInfo，若无效则 isValid=false
+    // @return RSS_EnvironmentInfo，若无效则 isValid=false（无效时每次新建，不与其他调用方共享）
     static RSS_EnvironmentInfo GetEnvironmentInfo(IEntity entity)
     {
-        if (!s_pEnvInfoCache)
-            s_pEnvInfoCache = new RSS_EnvironmentInfo();
-
-        s_pEnvInfoCache.temperature = 20.0;
-        s_pEnvInfoCache.rainIntensity = 0.0;
-        s_pEnvInfoCache.windSpeed = 0.0;
-        s_pEnvInfoCache.windDirection = 0.0;
-        s_pEnvInfoCache.surfaceWetness = 0.0;
-        s_pEnvInfoCache.totalWetWeight = 0.0;
-        s_pEnvInfoCache.isIndoor = false;
-        s_pEnvInfoCache.heatStressMultiplier = 1.0;
-        s_pEnvInfoCache.heatStressPenalty = 0.0;
-        s_pEnvInfoCache.coldStressPenalty = 0.0;
-        s_pEnvInfoCache.isValid = false;
+        SCR_CharacterControllerComponent ctrl = GetRssController(entity);
+        if (!ctrl || !ctrl.GetRssEnvironmentFactor())
+            return NewInvalidEnvironmentInfo();
+
+        RSS_EntitySnapshot snapshot = ctrl.RSS_GetApiSnapshot();
+        RefreshEnvironmentInfo(ctrl, snapshot);
+        return snapshot.environment;
+    }
+
+    // 一次遍历全部受管实体：snapshots 被清空后按登记顺序填入（仅 HasRssData 的实体）
+    // @return 填入数量
+    static int GetAllManagedSnapshots(out array<RSS_EntitySnapshot> snapshots)
+    {
+        if (!snapshots)
+            snapshots = new array<RSS_EntitySnapshot>();
+        snapshots.Clear();
+        if (!s_aManagedControllers)
+            return 0;
+
+        for (int i = s_aManagedControllers.Count() - 1; i >= 0; i--)
+        {
+            if (!s_aManagedControllers[i])
+                s_aManagedControllers.Remove(i);
+        }
+
+        foreach (SCR_CharacterControllerComponent ctrl : s_aManagedControllers)
+        {
+            if (!ctrl.HasRssData())
+                continue;
+            RSS_EntitySnapshot snapshot = ctrl.RSS_GetApiSnapshot();
+            RefreshPlayerInfo(ctrl, snapshot);
+            RefreshEnvironmentInfo(ctrl, snapshot);
+            snapshots.Insert(snapshot);
+        }
+        return snapshots.Count();
+    }
 
+    // 获取实体的状态边沿事件（力竭/恢复、W′ 耗尽/重新武装、冲刺门禁、AI 状态、体力阈值）
+    // 首次获取即启用该实体的 tick 末判定；事件在运行体力 tick 的一端触发
+    // @param entity 角色实体
+    // @return SCR_RSS_StateEvents 或 null（非 RSS 角色）
+    static SCR_RSS_StateEvents GetStateEvents(IEntity entity)
+    {
         SCR_CharacterControllerComponent ctrl = GetRssController(entity);
         if (!ctrl)
-            return s_pEnvInfoCache;
-
-        SCR_RSS_EnvironmentFactor env = ctrl.GetRssEnvironmentFactor();
-        if (!env)
-            return s_pEnvInfoCache;
-
-        s_pEnvInfoCache.temperature = env.GetTemperature();
-        s_pEnvInfoCache.rainIntensity = env.GetRainIntensity();
-        s_pEnvInfoCache.windSpeed = env.GetWindSpeed();
-        s_pEnvInfoCache.windDirection = env.GetWindDirection();
-        s_pEnvInfoCache.surfaceWetness = env.GetSurfaceWetness();
-        s_pEnvInfoCache.totalWetWeight = env.GetTotalWetWeight();
-        s_pEnvInfoCache.isIndoor = env.IsIndoorForEntity(entity);
-        s_pEnvInfoCache.heatStressMultiplier = env.GetHeatStressMultiplier();
-        s_pEnvInfoCache.heatStressPenalty = env.GetHeatStressPenalty();
-        s_pEnvInfoCache.coldStressPenalty = env.GetColdStressPenalty();
-        s_pEnvInfoCache.isValid = true;
-
-        return s_pEnvInfoCache;
+            return null;
+        return ctrl.RSS_GetStateEvents();
     }
 
     // 检查实体是否由 RSS 管理（有 RSS 扩展的控制器且已初始化）
@@ -165,4 +161,111 @@ class SCR_RSS_API
             return false;
         return ctrl.HasRssData();
     }
+
+    // 控制器 OnInit 时登记
+    static void RegisterManaged(SCR_CharacterControllerComponent ctrl)
+    {
+        if (!ctrl)
+            return;
+        if (!s_aManagedControllers)
+            s_aManagedControllers = new array<SCR_CharacterControllerComponent>();
+        if (s_aManagedControllers.Find(ctrl) < 0)
+            s_aManagedControllers.Insert(ctrl);
+    }
+
+    // 控制器删除时注销
+    static void UnregisterManaged(SCR_CharacterControllerComponent ctrl)
+    {
+        if (!ctrl || !s_aManagedControllers)
+            return;
+        int idx = s_aManagedControllers.Find(ctrl);
+        if (idx >= 0)
+            s_aManagedControllers.Remove(idx);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static void RefreshPlayerInfo(SCR_CharacterControllerComponent ctrl, RSS_EntitySnapshot snapshot)
+    {
+        int stamp = ctrl.RSS_GetApiSnapshotStamp();
+        if (snapshot.playerStamp == stamp)
+            return;
+        snapshot.playerStamp = stamp;
+
+        RSS_PlayerInfo info = snapshot.player;
+        info.staminaPercent = ctrl.GetRssStaminaPercent();
+        info.speedMultiplier = ctrl.GetRssSpeedMultiplier();
+        info.currentSpeed = ctrl.GetRssCurrentSpeed();
+        info.movementPhase = ctrl.GetRssMovementPhase();
+        info.isSprinting = ctrl.GetRssIsSprinting();
+        info.isExhausted = ctrl.GetRssIsExhausted();
+        info.isSwimming = ctrl.GetRssIsSwimming();
+        info.currentWeight = ctrl.GetRssCurrentWeight();
+        info.wPrimePool01 = ctrl.GetRssWPrimePool01();
+        info.anaerobicPercent = info.wPrimePool01;
+        info.wPrimeMaxJoules = SCR_RSS_ConfigBridge.GetWPrimeMaxJoules();
+        SCR_RSS_AnaerobicBurst burst = ctrl.RSS_GetWPrimeBurst();
+        if (burst)
+            info.wPrimeJoules = burst.GetWPrimeJoules();
+        else
+            info.wPrimeJoules = info.wPrimePool01 * info.wPrimeMaxJoules;
+        info.sprintCooldownRemainingSec = ctrl.GetRssSprintCooldownRemainingSec();
+        info.sprintAllowed = ctrl.GetRssSprintAllowed();
+        info.netStaminaRatePerSec = 0.0;
+        StaminaTickRates rates = ctrl.RSS_GetTickRates();
+        if (rates)
+            info.netStaminaRatePerSec = rates.netPerSec;
+        info.tickId = ctrl.RSS_GetTickId();
+        info.isValid = true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static void RefreshEnvironmentInfo(SCR_CharacterControllerComponent ctrl, RSS_EntitySnapshot snapshot)
+    {
+        int stamp = ctrl.RSS_GetApiSnapshotStamp();
+        if (snapshot.environmentStamp == stamp)
+            return;
+
+        RSS_EnvironmentInfo info = snapshot.environment;
+        SCR_RSS_EnvironmentFactor env = ctrl.GetRssEnvironmentFactor();
+        if (!env)
+        {
+            info.isValid = false;
+            return;
+        }
+        snapshot.environmentStamp = stamp;
+
+        info.temperature = env.GetTemperature();
+        info.rainIntensity = env.GetRainIntensity();
+        info.windSpeed = env.GetWindSpeed();
+        info.windDirection = env.GetWindDirection();
+        info.surfaceWetness = env.GetSurfaceWetness();
+        info.totalWetWeight = env.GetTotalWetWeight();
+        info.isIndoor = env.IsIndoorForEntity(snapshot.entity);
+        info.heatStressMultiplier = env.GetHeatStressMultiplier();
+        info.heatStressPenalty = env.GetHeatStressPenalty();
+        info.coldStressPenalty = env.GetColdStressPenalty();
+        info.tickId = ctrl.RSS_GetTickId();
+        info.isValid = true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static RSS_PlayerInfo NewInvalidPlayerInfo()
+    {
+        RSS_PlayerInfo info = new RSS_PlayerInfo();
+        info.speedMultiplier = 1.0;
+        info.tickId = -1;
+        info.isValid = false;
+        return info;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected static RSS_EnvironmentInfo NewInvalidEnvironmentInfo()
+    {
+        RSS_EnvironmentInfo info = new RSS_EnvironmentInfo();
+        info.temperature = 20.0;
+        info.heatStressMultiplier = 1.0;
+        info.tickId = -1;
+        info.isValid = false;
+        return info;
+    }
 }
@@ -21,6 +21,9 @@ class SCR_RSS_ConfigManager
     protected static const float SYNC_COOLDOWN = 2.0;  // 同步冷却（秒）
     protected static bool m_bIsSyncing = false;  // 是否正在同步
     protected static bool m_bServerDataExportEnabled = false;  // 客户端保存的“服务器是否开启数据导出”（用于决定是否发送体力 RPC）
+    protected static int m_iConfigEpoch = 0;  // 配置纪元：设置被替换/改写后递增，派生缓存的子系统按纪元惰性重算
+    protected static int m_iDiskContentHash = 0;  // 磁盘 JSON 内容哈希（按 Save 同构序列化），相同则跳过写盘与备份
+    protected static bool m_bDiskContentHashValid = false;
 
     // 默认值与合理范围常量（便于维护）
     protected static const int DEFAULT_UPDATE_INTERVAL_MS = 5000;    // 检测/日志更新间隔
@@ -45,6 +48,19 @@ class SCR_RSS_ConfigManager
             Load();
         return m_Settings;
     }
+
+    //! 当前配置纪元。缓存了配置派生值的子系统记录自己应用过的纪元，在下一次 tick 发现不同即重算；
+    //! 管理员改配置只需递增一次，不必逐实体通知
+    static int GetConfigEpoch()
+    {
+        return m_iConfigEpoch;
+    }
+
+    //! 设置对象被替换或字段被改写后调用（加载/保存经 UpdateConfigCache 自动调用；客户端应用复制配置时显式调用）
+    static void NotifySettingsChanged()
+    {
+        m_iConfigEpoch++;
+    }
     
     // 加载配置文件
     static void Load()
@@ -68,7 +84,7 @@ class SCR_RSS_ConfigManager
         m_Settings.m_bDisableAIStaminaCalc = true;
         m_bIsLoaded = true;
         m_fLastLoadTime = 0.0;
-        EnsureDefaultValues();
+        NormalizeSettings();
         UpdateConfigCache();
         Print("[RSS_ConfigManager] Workbench: Using embedded preset values (profile bypassed). Debug ON, batch 1s, HUD ON, DataExport ON, MudSlip OFF (tuning pending), AI stamina calc OFF.");
         return;
@@ -98,7 +114,7 @@ class SCR_RSS_ConfigManager
 
             m_bIsLoaded = true;
             m_fLastLoadTime = 0.0;
-            EnsureDefaultValues();
+            NormalizeSettings();
             UpdateConfigCache();
             if (!m_bLoggedClientDefaultsOnce)
             {
@@ -117,13 +133,18 @@ class SCR_RSS_ConfigManager
             return;
         
         m_Settings = new SCR_RSS_Settings();
+        m_bDiskContentHashValid = false;
         
         // 尝试从磁盘读取
         // 使用官方的JsonLoadContext
         JsonLoadContext loadContext = new JsonLoadContext();
-        if (loadContext.LoadFromFile(CONFIG_PATH))
+        bool fileLoaded = loadContext.LoadFromFile(CONFIG_PATH);
+        if (fileLoaded)
         {
             loadContext.ReadValue("", m_Settings);
+            // 记录读入内容的哈希：下方修正后若序列化结果不变，本次加载既不写盘也不备份
+            m_iDiskContentHash = ComputeSettingsHash(m_Settings);
+            m_bDiskContentHashValid = true;
             
             // 检查是否已应用服务器配置
             if (!m_bIsServerConfigApplied)
@@ -148,12 +169,8 @@ class SCR_RSS_ConfigManager
                 if (!isCustom)
                 {
                     // 如果玩家用的是系统预设，强制用代码里的最新Optuna值覆盖内存
-                    // 这样即使 JSON 里是旧值，也会被更新
+                    // 这样即使 JSON 里是旧值，也会被更新；写回 JSON 由加载末尾按内容哈希统一决定
                     m_Settings.InitPresets(true);
-                    
-                    // 既然内存更新了，我们需要立即保存到 JSON，确保文件同步
-                    if (CanWriteConfig())
-                        Save();
                 }
                 else
                 {
@@ -177,17 +194,7 @@ class SCR_RSS_ConfigManager
                 configVersion = "0.0.0";
             
             if (configVersion != CURRENT_VERSION)
-            {
                 m_Settings.m_sConfigVersion = CURRENT_VERSION;
-                Save();
-            }
-            
-            // 验证配置：只修正无效字段，不重置整个配置（避免丢失用户自定义）
-            if (!ValidateSettings(m_Settings))
-            {
-                Print("[RSS_ConfigManager] Warning: Invalid settings detected, correcting out-of-range values");
-                FixInvalidSettings();
-            }
         }
         else
         {
@@ -212,19 +219,18 @@ class SCR_RSS_ConfigManager
             m_Settings.m_bEnableMudSlipMechanism = false;
             m_Settings.m_bEnableAIStaminaCombatEffects = false;
             m_Settings.m_bDisableAIStaminaCalc = true;
-            
-            if (CanWriteConfig())
-            {
-                Save();
-                Print("[RSS_ConfigManager] Default settings created at " + CONFIG_PATH);
-            }
         }
         
         m_bIsLoaded = true;
         m_fLastLoadTime = currentTime;
         
-        // 确保所有字段有合理的默认值（兼容旧版本配置文件或空值）
-        EnsureDefaultValues();
+        // 单次修正：补默认值 + 越界 clamp（只修正无效字段，不重置整个配置，避免丢失用户自定义）
+        if (NormalizeSettings())
+            Print("[RSS_ConfigManager] Warning: Invalid or missing settings detected, corrected in memory");
+        
+        // 每次加载至多写盘一次：序列化内容与磁盘一致则跳过写盘与备份
+        if (CanWriteConfig() && WriteConfigIfChanged() && !fileLoaded)
+            Print("[RSS_ConfigManager] Default settings created at " + CONFIG_PATH);
         
         // 更新配置缓存
         UpdateConfigCache();
@@ -260,12 +266,21 @@ class SCR_RSS_ConfigManager
         }
     }
     
+    //! 单次修正：补默认值 + 越界 clamp；返回是否改动了内存配置（需要写回）
+    //! 只修改内存，写盘由调用方按内容哈希决定（加载路径至多一次）
+    protected static bool NormalizeSettings()
+    {
+        bool defaultsApplied = EnsureDefaultValues();
+        bool clamped = FixInvalidSettings();
+        return defaultsApplied || clamped;
+    }
+
     // 确保所有字段有合理的默认值
-    // 用于兼容旧版本配置文件或处理空值
-    protected static void EnsureDefaultValues()
+    // 用于兼容旧版本配置文件或处理空值；返回是否设置了默认值
+    protected static bool EnsureDefaultValues()
     {
         if (!m_Settings)
-            return;
+            return false;
         
         bool needsSave = false;
         
@@ -339,13 +354,7 @@ class SCR_RSS_ConfigManager
         // 注意：m_bHintDisplayEnabled / m_bDebugLogEnabled 不覆盖，保留用户设置
         // 用户通过 JSON 修改的 UI 设置（hint、debug）必须被保留
         
-        // 如果有任何默认值被设置，保存配置（客户端仅更新缓存，不写盘）
-        if (needsSave)
-        {
-            if (CanWriteConfig())
-                Print("[RSS_ConfigManager] Saving config with default values applied");
-            Save();
-        }
+        return needsSave;
     }
 
     // 仅允许服务器写入配置文件，防止客户端覆盖服务器 JSON
@@ -358,7 +367,7 @@ class SCR_RSS_ConfigManager
         return Replication.IsServer();
     }
     
-    // 保存配置文件（原子写入：先写临时文件再 rename）
+    // 保存配置文件（原子写入：先写临时文件再 rename；内容哈希与磁盘一致时跳过写盘与备份）
     static void Save()
     {
         if (!m_Settings)
@@ -373,6 +382,41 @@ class SCR_RSS_ConfigManager
             return;
         }
 
+        WriteConfigIfChanged();
+        
+        // 更新配置缓存
+        UpdateConfigCache();
+        
+        // 检测配置变更并通知
+        if (Replication.IsServer())
+        {
+            DetectConfigChanges();
+            ReplicateConfigToClients();
+        }
+    }
+
+    //! 刚读入、尚未修正的配置按 Save 同构序列化后取哈希（不打包平面数组，保留磁盘原值）
+    protected static int ComputeSettingsHash(SCR_RSS_Settings settings)
+    {
+        if (!settings)
+            return 0;
+        JsonSaveContext saveContext = new JsonSaveContext();
+        saveContext.WriteValue("", settings);
+        string json = saveContext.ExportToString();
+        return json.Hash();
+    }
+
+    //! 内容与磁盘一致（哈希相同且文件仍在）则不写盘、不备份；返回是否实际写入
+    protected static bool WriteConfigIfChanged()
+    {
+        JsonSaveContext saveContext = new JsonSaveContext();
+        m_Settings.PackParamsToFlatArrays();
+        saveContext.WriteValue("", m_Settings);
+        string json = saveContext.ExportToString();
+        int hash = json.Hash();
+        if (m_bDiskContentHashValid && hash == m_iDiskContentHash && FileIO.FileExists(CONFIG_PATH))
+            return false;
+
         // CRITICAL FIX: Atomic write — write to temp file first, then rename.
         // This prevents JSON corruption from crashes during SaveToFile.
         string temp_path = CONFIG_PATH + ".tmp";
@@ -381,9 +425,6 @@ class SCR_RSS_ConfigManager
         CreateConfigBackup();
         
         // 写入临时文件
-        JsonSaveContext saveContext = new JsonSaveContext();
-        m_Settings.PackParamsToFlatArrays();
-        saveContext.WriteValue("", m_Settings);
         saveContext.SaveToFile(temp_path);
         
         // 验证临时文件存在后再替换主文件
@@ -399,6 +440,8 @@ class SCR_RSS_ConfigManager
             if (FileIO.CopyFile(temp_path, CONFIG_PATH))
             {
                 FileIO.DeleteFile(temp_path);
+                m_iDiskContentHash = hash;
+                m_bDiskContentHashValid = true;
                 Print("[RSS_ConfigManager] Settings saved atomically to " + CONFIG_PATH);
             }
             else
@@ -410,16 +453,7 @@ class SCR_RSS_ConfigManager
         {
             Print("[RSS_ConfigManager] ERROR: Temp file not written, config NOT saved!");
         }
-        
-        // 更新配置缓存
-        UpdateConfigCache();
-        
-        // 检测配置变更并通知
-        if (Replication.IsServer())
-        {
-            DetectConfigChanges();
-            ReplicateConfigToClients();
-        }
+        return m_bDiskContentHashValid && m_iDiskContentHash == hash;
     }
     
     // 创建配置备份
@@ -462,6 +496,8 @@ class SCR_RSS_ConfigManager
             return;
         }
         
+        NotifySettingsChanged();
+
         // 创建配置副本作为缓存
         m_CachedSettings = new SCR_RSS_Settings();
         
@@ -578,10 +614,11 @@ class SCR_RSS_ConfigManager
     
     // 修正无效配置值（仅 clamp 到合法范围，不重置其他字段）
     // 用于替代 ResetToDefaults，避免因单个字段越界而丢失全部用户配置
-    protected static void FixInvalidSettings()
+    // 返回是否有字段被修正
+    protected static bool FixInvalidSettings()
     {
         if (!m_Settings)
-            return;
+            return false;
         
         bool needsSave = false;
         
@@ -655,38 +692,7 @@ class SCR_RSS_ConfigManager
             }
         }
         
-        if (needsSave)
-            Save();
-    }
-    
-    // 验证配置值的有效性
-    // 注意：值为 0 或空不算无效，会由 EnsureDefaultValues() 处理
-    // 这里只检查明显超出合理范围的值
-    protected static bool ValidateSettings(SCR_RSS_Settings settings)
-    {
-        if (!settings)
-            return false;
-        
-        bool isValid = true;
-        
-        // 倍率范围（>0 时才校验）
-        if (settings.m_fStaminaDrainMultiplier > 0 && settings.m_fStaminaDrainMultiplier > STAMINA_MULT_MAX)
-            isValid = false;
-        if (settings.m_fStaminaRecoveryMultiplier > 0 && settings.m_fStaminaRecoveryMultiplier > STAMINA_MULT_MAX)
-            isValid = false;
-        if (settings.m_fSprintSpeedMultiplier > 0 && settings.m_fSprintSpeedMultiplier > SPRINT_SPEED_MAX)
-            isValid = false;
-        if (settings.m_fSprintStaminaDrainMultiplier > 0 && settings.m_fSprintStaminaDrainMultiplier > SPRINT_DRAIN_MAX)
-            isValid = false;
-        // 间隔范围
-        if (settings.m_iDebugUpdateInterval > 0 && settings.m_iDebugUpdateInterval > MAX_UPDATE_INTERVAL_MS)
-            isValid = false;
-        if (settings.m_iTerrainUpdateInterval > 0 && settings.m_iTerrainUpdateInterval > MAX_UPDATE_INTERVAL_MS)
-            isValid = false;
-        if (settings.m_iEnvironmentUpdateInterval > 0 && settings.m_iEnvironmentUpdateInterval > MAX_UPDATE_INTERVAL_MS)
-            isValid = false;
-        
-        return isValid;
+        return needsSave;
     }
     
     // 获取配置文件路径
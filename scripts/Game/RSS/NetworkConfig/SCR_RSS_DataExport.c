@@ -35,6 +35,9 @@ class RSS_ExportPlayerEntry
     [Attribute("0.0", desc: "Current weight kg")]
     float currentWeight;
 
+    [Attribute("0.0", desc: "Net stamina rate per second (last tick)")]
+    float netStaminaRatePerSec;
+
     [Attribute("20.0", desc: "Temperature C")]
     float temperature;
 
@@ -121,6 +124,7 @@ class SCR_RSS_DataExport
                     float nowSec = GetGame().GetWorld().GetWorldTime() / 1000.0;
                     env.ForceUpdate(nowSec, entity, 0.0);
                 }
+                ctrl.RSS_GetApiSnapshot().Invalidate();
             }
 
             RSS_PlayerInfo playerInfo = SCR_RSS_API.GetPlayerInfo(entity);
@@ -143,6 +147,7 @@ class SCR_RSS_DataExport
             entry.isExhausted = playerInfo.isExhausted;
             entry.isSwimming = playerInfo.isSwimming;
             entry.currentWeight = playerInfo.currentWeight;
+            entry.netStaminaRatePerSec = playerInfo.netStaminaRatePerSec;
 
             if (envInfo.isValid)
             {
@@ -1,6 +1,6 @@
 // RSS Parameter Model - serializable configuration parameters
 // Attribute-free to reduce Workbench compile ICE (Attribute AST pressure).
-// Defaults live in field initializers + SCR_RSS_SettingsPresetBake.
+// Defaults live in field initializers + SCR_RSS_PresetTable (copied by SCR_RSS_SettingsPresetBake).
 // Disk/network persistence: float arrays via SCR_RSS_SettingsSync.
 //
 [BaseContainerProps()]
@@ -0,0 +1,341 @@
+//! 预设参数常量表 —— 由 tools/embed_json_to_c.py 生成，勿手改
+//!
+//! 每行一个预设，每列一个 SCR_RSS_Params 字段；列序与 SCR_RSS_SettingsSync.WriteParamsToArray 一致，
+//! 预设实例化即整行经 ApplyParamsFromArray 拷入，与网络包 / JSON 平面数组共用同一布局。
+
+class SCR_RSS_PresetTable
+{
+    static const int PARAM_COUNT = 64;
+
+    static const int PRESET_ELITE_STANDARD = 0;
+    static const int PRESET_STANDARD_MILSIM = 1;
+    static const int PRESET_TACTICAL_ACTION = 2;
+    static const int PRESET_CUSTOM = 3;
+
+    // EliteStandard — v6 optimizer merge
+    // 低 combat_ease + 低 recovery_ease → 最拟真/最硬核
+    // metrics: ease=0.7956 recovery=0.000941 realism=2.5194
+    static const float ELITE_STANDARD[PARAM_COUNT] = {
+        1.7007074390325853e-07, // energy_to_stamina_coeff
+        9.2048888822953643e-05, // base_recovery_rate
+        0.7036252376302605, // standing_recovery_multiplier
+        1.3922029498811115, // crouching_recovery_multiplier
+        1.6323164696562544, // prone_recovery_multiplier
+        1.9923493936336870e-04, // load_recovery_penalty_coeff
+        2.0, // load_recovery_penalty_exponent
+        0.32914617595982326, // encumbrance_speed_penalty_coeff
+        1.5, // encumbrance_speed_penalty_exponent
+        0.75, // encumbrance_speed_penalty_max
+        2.6017248000726663, // encumbrance_stamina_drain_coeff
+        0.7, // load_metabolic_dampening
+        2.3150469479475108e-04, // max_recovery_per_tick
+        3.5, // sprint_stamina_drain_multiplier
+        0.015, // fatigue_accumulation_coeff
+        2.0, // fatigue_max_factor
+        0.9, // aerobic_efficiency_factor
+        1.2, // anaerobic_efficiency_factor
+        0.32345781637146453, // recovery_nonlinear_coeff
+        1.5840666229329088, // fast_recovery_multiplier
+        0.9172495737205478, // medium_recovery_multiplier
+        0.35370534372094853, // slow_recovery_multiplier
+        0.8, // marginal_decay_threshold
+        1.1, // marginal_decay_coeff
+        0.2, // min_recovery_stamina_threshold
+        3.0, // min_recovery_rest_time_seconds
+        0.22105729089449438, // sprint_speed_boost
+        5.5, // sprint_velocity_threshold
+        0.3038205335360764, // willpower_threshold
+        0.20691304690460754, // sprint_enable_threshold
+        2.954245615946638, // posture_crouch_multiplier
+        3.08595425773382, // posture_prone_multiplier
+        0.22, // jump_efficiency
+        0.5, // jump_height_guess
+        0.0, // jump_horizontal_speed_guess
+        0.12, // climb_iso_efficiency
+        0.08, // slope_uphill_coeff
+        0.03, // slope_downhill_coeff
+        20.0, // swimming_base_power
+        25.0, // swimming_encumbrance_threshold
+        3.0, // swimming_static_drain_multiplier
+        2.0, // swimming_dynamic_power_efficiency
+        5.0000000000000002e-05, // swimming_energy_to_stamina_coeff
+        1.5, // env_heat_stress_max_multiplier
+        5.0, // env_rain_weight_max
+        0.05, // env_wind_resistance_coeff
+        0.4, // env_mud_penalty_max
+        0.02, // env_temperature_heat_penalty_coeff
+        0.05, // env_temperature_cold_recovery_penalty_coeff
+        0.15, // env_surface_wetness_prone_penalty
+        907.7632740817373, // sustainable_watts
+        1.4, // v5_walk_speed_ms
+        3.05, // v5_run_speed_ms
+        4.5, // v5_sprint_speed_ms
+        0.2, // anaerobic_sprint_enable_threshold
+        180.0, // burst_cooldown_full_seconds
+        75.0, // burst_cooldown_short_seconds
+        0.12, // anaerobic_drain_per_sec
+        0.08, // anaerobic_recovery_per_sec
+        907.7632740817373, // critical_power_watts
+        2.2897951197083501e+04, // w_prime_max_joules
+        11.142296222078262, // w_prime_recovery_w_per_s
+        2730.1644178188026, // sprint_power_cap_watts
+        0.0 // w_prime_recovery_mode
+    };
+
+    // StandardMilsim — v6 optimizer merge
+    // 战斗/恢复折中 → 拟真与可玩性平衡
+    // metrics: ease=0.7934 recovery=0.001236 realism=3.5105
+    static const float STANDARD_MILSIM[PARAM_COUNT] = {
+        1.2020815272044153e-07, // energy_to_stamina_coeff
+        1.0648818614147173e-04, // base_recovery_rate
+        0.8028442393119766, // standing_recovery_multiplier
+        1.448386751595432, // crouching_recovery_multiplier
+        1.7543096929090567, // prone_recovery_multiplier
+        1.2275957596568957e-04, // load_recovery_penalty_coeff
+        2.0, // load_recovery_penalty_exponent
+        0.2314990834591352, // encumbrance_speed_penalty_coeff
+        1.5, // encumbrance_speed_penalty_exponent
+        0.75, // encumbrance_speed_penalty_max
+        2.574976444921473, // encumbrance_stamina_drain_coeff
+        0.7, // load_metabolic_dampening
+        3.8418197485776010e-04, // max_recovery_per_tick
+        3.5, // sprint_stamina_drain_multiplier
+        0.015, // fatigue_accumulation_coeff
+        2.0, // fatigue_max_factor
+        0.9, // aerobic_efficiency_factor
+        1.2, // anaerobic_efficiency_factor
+        0.5411254316579374, // recovery_nonlinear_coeff
+        1.6544610064331133, // fast_recovery_multiplier
+        1.0049846211569977, // medium_recovery_multiplier
+        0.33038804605773786, // slow_recovery_multiplier
+        0.8, // marginal_decay_threshold
+        1.1, // marginal_decay_coeff
+        0.2, // min_recovery_stamina_threshold
+        3.0, // min_recovery_rest_time_seconds
+        0.20259772471376725, // sprint_speed_boost
+        5.5, // sprint_velocity_threshold
+        0.3968922007178048, // willpower_threshold
+        0.1863367010530013, // sprint_enable_threshold
+        2.505195675044107, // posture_crouch_multiplier
+        4.179512239327796, // posture_prone_multiplier
+        0.22, // jump_efficiency
+        0.5, // jump_height_guess
+        0.0, // jump_horizontal_speed_guess
+        0.12, // climb_iso_efficiency
+        0.08, // slope_uphill_coeff
+        0.03, // slope_downhill_coeff
+        20.0, // swimming_base_power
+        25.0, // swimming_encumbrance_threshold
+        3.0, // swimming_static_drain_multiplier
+        2.0, // swimming_dynamic_power_efficiency
+        5.0000000000000002e-05, // swimming_energy_to_stamina_coeff
+        1.5, // env_heat_stress_max_multiplier
+        5.0, // env_rain_weight_max
+        0.05, // env_wind_resistance_coeff
+        0.4, // env_mud_penalty_max
+        0.02, // env_temperature_heat_penalty_coeff
+        0.05, // env_temperature_cold_recovery_penalty_coeff
+        0.15, // env_surface_wetness_prone_penalty
+        1031.0269402827182, // sustainable_watts
+        1.4, // v5_walk_speed_ms
+        3.2, // v5_run_speed_ms
+        4.5, // v5_sprint_speed_ms
+        0.2, // anaerobic_sprint_enable_threshold
+        120.0, // burst_cooldown_full_seconds
+        60.0, // burst_cooldown_short_seconds
+        0.12, // anaerobic_drain_per_sec
+        0.08, // anaerobic_recovery_per_sec
+        1031.0269402827182, // critical_power_watts
+        3.0694588204147236e+04, // w_prime_max_joules
+        12.56888534461861, // w_prime_recovery_w_per_s
+        2804.5755541954586, // sprint_power_cap_watts
+        1.0 // w_prime_recovery_mode
+    };
+
+    // TacticalAction — v6 optimizer merge
+    // 高 combat_ease + 高 recovery_ease → 战斗最宽容
+    // metrics: ease=0.7949 recovery=0.001275 realism=4.0103
+    static const float TACTICAL_ACTION[PARAM_COUNT] = {
+        1.0430233936563329e-07, // energy_to_stamina_coeff
+        1.1990859520060127e-04, // base_recovery_rate
+        0.8836240704260153, // standing_recovery_multiplier
+        1.5289464271704793, // crouching_recovery_multiplier
+        2.002116594805323, // prone_recovery_multiplier
+        1.0228602818846379e-04, // load_recovery_penalty_coeff
+        2.0, // load_recovery_penalty_exponent
+        0.21711050931835466, // encumbrance_speed_penalty_coeff
+        1.5, // encumbrance_speed_penalty_exponent
+        0.75, // encumbrance_speed_penalty_max
+        2.507952749010908, // encumbrance_stamina_drain_coeff
+        0.7, // load_metabolic_dampening
+        4.1993135026285460e-04, // max_recovery_per_tick
+        3.5, // sprint_stamina_drain_multiplier
+        0.015, // fatigue_accumulation_coeff
+        2.0, // fatigue_max_factor
+        0.9, // aerobic_efficiency_factor
+        1.2, // anaerobic_efficiency_factor
+        0.36243363229323305, // recovery_nonlinear_coeff
+        1.8490315942158921, // fast_recovery_multiplier
+        1.0458997891646118, // medium_recovery_multiplier
+        0.3456477398318387, // slow_recovery_multiplier
+        0.8, // marginal_decay_threshold
+        1.1, // marginal_decay_coeff
+        0.2, // min_recovery_stamina_threshold
+        3.0, // min_recovery_rest_time_seconds
+        0.21089948340831, // sprint_speed_boost
+        5.5, // sprint_velocity_threshold
+        0.3907947102871067, // willpower_threshold
+        0.28692893122679247, // sprint_enable_threshold
+        3.3382056894573235, // posture_crouch_multiplier
+        4.148454793616982, // posture_prone_multiplier
+        0.22, // jump_efficiency
+        0.5, // jump_height_guess
+        0.0, // jump_horizontal_speed_guess
+        0.12, // climb_iso_efficiency
+        0.08, // slope_uphill_coeff
+        0.03, // slope_downhill_coeff
+        20.0, // swimming_base_power
+        25.0, // swimming_encumbrance_threshold
+        3.0, // swimming_static_drain_multiplier
+        2.0, // swimming_dynamic_power_efficiency
+        5.0000000000000002e-05, // swimming_energy_to_stamina_coeff
+        1.5, // env_heat_stress_max_multiplier
+        5.0, // env_rain_weight_max
+        0.05, // env_wind_resistance_coeff
+        0.4, // env_mud_penalty_max
+        0.02, // env_temperature_heat_penalty_coeff
+        0.05, // env_temperature_cold_recovery_penalty_coeff
+        0.15, // env_surface_wetness_prone_penalty
+        1080.5772859061578, // sustainable_watts
+        1.4, // v5_walk_speed_ms
+        3.4, // v5_run_speed_ms
+        4.5, // v5_sprint_speed_ms
+        0.2, // anaerobic_sprint_enable_threshold
+        90.0, // burst_cooldown_full_seconds
+        45.0, // burst_cooldown_short_seconds
+        0.12, // anaerobic_drain_per_sec
+        0.08, // anaerobic_recovery_per_sec
+        1080.5772859061578, // critical_power_watts
+        3.1461312101281204e+04, // w_prime_max_joules
+        12.873066473065165, // w_prime_recovery_w_per_s
+        2904.58612356082, // sprint_power_cap_watts
+        1.0 // w_prime_recovery_mode
+    };
+
+    // Custom — 手动调参备份默认值（不由 JSON 驱动，CP/W′ 取 Standard 档）
+    static const float CUSTOM[PARAM_COUNT] = {
+        1.1170000000000000e-07, // energy_to_stamina_coeff
+        2.9999999999999997e-04, // base_recovery_rate
+        2.0, // standing_recovery_multiplier
+        1.5, // crouching_recovery_multiplier
+        2.2, // prone_recovery_multiplier
+        4.0000000000000002e-04, // load_recovery_penalty_coeff
+        2.0, // load_recovery_penalty_exponent
+        0.2, // encumbrance_speed_penalty_coeff
+        1.5, // encumbrance_speed_penalty_exponent
+        0.75, // encumbrance_speed_penalty_max
+        1.5, // encumbrance_stamina_drain_coeff
+        0.7, // load_metabolic_dampening
+        4.0000000000000002e-04, // max_recovery_per_tick
+        3.5, // sprint_stamina_drain_multiplier
+        0.015, // fatigue_accumulation_coeff
+        2.0, // fatigue_max_factor
+        1.0, // aerobic_efficiency_factor
+        1.3, // anaerobic_efficiency_factor
+        0.5, // recovery_nonlinear_coeff
+        3.0, // fast_recovery_multiplier
+        1.8, // medium_recovery_multiplier
+        0.6, // slow_recovery_multiplier
+        0.85, // marginal_decay_threshold
+        1.0, // marginal_decay_coeff
+        0.15, // min_recovery_stamina_threshold
+        3.0, // min_recovery_rest_time_seconds
+        0.3, // sprint_speed_boost
+        5.5, // sprint_velocity_threshold
+        0.35, // willpower_threshold
+        0.25, // sprint_enable_threshold
+        2.0, // posture_crouch_multiplier
+        2.5, // posture_prone_multiplier
+        0.22, // jump_efficiency
+        0.5, // jump_height_guess
+        0.0, // jump_horizontal_speed_guess
+        0.12, // climb_iso_efficiency
+        0.08, // slope_uphill_coeff
+        0.03, // slope_downhill_coeff
+        25.0, // swimming_base_power
+        25.0, // swimming_encumbrance_threshold
+        3.5, // swimming_static_drain_multiplier
+        2.2, // swimming_dynamic_power_efficiency
+        5.0000000000000002e-05, // swimming_energy_to_stamina_coeff
+        1.3, // env_heat_stress_max_multiplier
+        5.0, // env_rain_weight_max
+        0.05, // env_wind_resistance_coeff
+        0.45, // env_mud_penalty_max
+        0.02, // env_temperature_heat_penalty_coeff
+        0.05, // env_temperature_cold_recovery_penalty_coeff
+        0.15, // env_surface_wetness_prone_penalty
+        1031.0269402827182, // sustainable_watts
+        1.4, // v5_walk_speed_ms
+        3.2, // v5_run_speed_ms
+        4.5, // v5_sprint_speed_ms
+        0.2, // anaerobic_sprint_enable_threshold
+        120.0, // burst_cooldown_full_seconds
+        60.0, // burst_cooldown_short_seconds
+        0.12, // anaerobic_drain_per_sec
+        0.08, // anaerobic_recovery_per_sec
+        1031.0269402827182, // critical_power_watts
+        3.0694588204147236e+04, // w_prime_max_joules
+        12.56888534461861, // w_prime_recovery_w_per_s
+        2804.5755541954586, // sprint_power_cap_watts
+        1.0 // w_prime_recovery_mode
+    };
+
+    protected static ref array<float> s_aRowScratch;
+
+    //------------------------------------------------------------------------------------------------
+    //! 整行拷入 p（preset 为 PRESET_*）
+    static void CopyToParams(int preset, SCR_RSS_Params p)
+    {
+        if (!p)
+            return;
+        if (!s_aRowScratch)
+            s_aRowScratch = new array<float>();
+        s_aRowScratch.Resize(PARAM_COUNT);
+
+        int i;
+        if (preset == PRESET_ELITE_STANDARD)
+        {
+            for (i = 0; i < PARAM_COUNT; i++)
+            {
+                s_aRowScratch[i] = ELITE_STANDARD[i];
+            }
+        }
+        else if (preset == PRESET_STANDARD_MILSIM)
+        {
+            for (i = 0; i < PARAM_COUNT; i++)
+            {
+                s_aRowScratch[i] = STANDARD_MILSIM[i];
+            }
+        }
+        else if (preset == PRESET_TACTICAL_ACTION)
+        {
+            for (i = 0; i < PARAM_COUNT; i++)
+            {
+                s_aRowScratch[i] = TACTICAL_ACTION[i];
+            }
+        }
+        else if (preset == PRESET_CUSTOM)
+        {
+            for (i = 0; i < PARAM_COUNT; i++)
+            {
+                s_aRowScratch[i] = CUSTOM[i];
+            }
+        }
+        else
+        {
+            return;
+        }
+
+        SCR_RSS_SettingsSync.ApplyParamsFromArray(p, s_aRowScratch);
+    }
+}
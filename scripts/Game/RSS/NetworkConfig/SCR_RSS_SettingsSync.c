@@ -2,6 +2,7 @@
 class SCR_RSS_SettingsSync
 {
     // ==================== Full sync helpers ====================
+    //! 列序即 SCR_RSS_PresetTable 的列序；增删字段需同步 tools/embed_json_to_c.py PARAM_FIELDS 并重新生成表
     static void WriteParamsToArray(SCR_RSS_Params p, array<float> outArr)
     {
         if (!outArr || !p)
@@ -0,0 +1,142 @@
+// Realistic Stamina System (RSS) - 状态边沿事件
+// 外部模组订阅体力状态切换，替代逐帧轮询 SCR_RSS_API
+// 用法：SCR_RSS_API.GetStateEvents(entity).GetOnExhaustedChanged().Insert(MyHandler);
+// 事件在该实体的体力 tick 末、状态切换当 tick 触发；首个 tick 只记录初值不触发。
+// 仅在运行体力 tick 的一端触发（玩家=本地客户端，AI=服务器）；无人订阅时 tick 不做任何判定。
+
+//! 布尔边沿：entity 为角色实体；active=true 表示进入该状态（力竭 / W′ 耗尽 / 冲刺被拦）
+void RSS_StateEdgeMethod(IEntity entity, bool active);
+typedef func RSS_StateEdgeMethod;
+typedef ScriptInvokerBase<RSS_StateEdgeMethod> RSS_StateEdgeInvoker;
+
+//! AI 体力状态机切换（见 SCR_RSS_AIStaminaState）
+void RSS_AIStateChangedMethod(IEntity entity, ERSS_AIStaminaState oldState, ERSS_AIStaminaState newState);
+typedef func RSS_AIStateChangedMethod;
+typedef ScriptInvokerBase<RSS_AIStateChangedMethod> RSS_AIStateChangedInvoker;
+
+//! 体力阈值穿越：rising=true 为自下而上越过 threshold
+void RSS_StaminaThresholdMethod(IEntity entity, float threshold, bool rising);
+typedef func RSS_StaminaThresholdMethod;
+typedef ScriptInvokerBase<RSS_StaminaThresholdMethod> RSS_StaminaThresholdInvoker;
+
+class SCR_RSS_StateEvents
+{
+    protected ref RSS_StateEdgeInvoker m_OnExhaustedChanged;
+    protected ref RSS_StateEdgeInvoker m_OnWPrimeDepletedChanged;
+    protected ref RSS_StateEdgeInvoker m_OnSprintBlockedChanged;
+    protected ref RSS_AIStateChangedInvoker m_OnAIStaminaStateChanged;
+    protected ref RSS_StaminaThresholdInvoker m_OnStaminaThresholdCrossed;
+    protected ref array<float> m_aStaminaThresholds;
+
+    protected bool m_bPrimed = false;
+    protected float m_fLastStamina = 0.0;
+    protected bool m_bLastExhausted = false;
+    protected bool m_bLastWPrimeDepleted = false;
+    protected bool m_bLastSprintBlocked = false;
+    protected ERSS_AIStaminaState m_eLastAIState = ERSS_AIStaminaState.FRESH;
+
+    //------------------------------------------------------------------------------------------------
+    //! 力竭 / 恢复（有氧侧 IsExhausted）
+    RSS_StateEdgeInvoker GetOnExhaustedChanged()
+    {
+        if (!m_OnExhaustedChanged)
+            m_OnExhaustedChanged = new RSS_StateEdgeInvoker();
+        return m_OnExhaustedChanged;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! W′ 耗尽 / 重新武装（与超速、冲刺门禁共用的施密特武装态）
+    RSS_StateEdgeInvoker GetOnWPrimeDepletedChanged()
+    {
+        if (!m_OnWPrimeDepletedChanged)
+            m_OnWPrimeDepletedChanged = new RSS_StateEdgeInvoker();
+        return m_OnWPrimeDepletedChanged;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 冲刺门禁拦截 / 放行（GetRssSprintAllowed 取反）
+    RSS_StateEdgeInvoker GetOnSprintBlockedChanged()
+    {
+        if (!m_OnSprintBlockedChanged)
+            m_OnSprintBlockedChanged = new RSS_StateEdgeInvoker();
+        return m_OnSprintBlockedChanged;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    RSS_AIStateChangedInvoker GetOnAIStaminaStateChanged()
+    {
+        if (!m_OnAIStaminaStateChanged)
+            m_OnAIStaminaStateChanged = new RSS_AIStateChangedInvoker();
+        return m_OnAIStaminaStateChanged;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 穿越 AddStaminaThreshold 登记的阈值时触发
+    RSS_StaminaThresholdInvoker GetOnStaminaThresholdCrossed()
+    {
+        if (!m_OnStaminaThresholdCrossed)
+            m_OnStaminaThresholdCrossed = new RSS_StaminaThresholdInvoker();
+        return m_OnStaminaThresholdCrossed;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 登记体力阈值 (0~1)；重复登记忽略
+    void AddStaminaThreshold(float threshold01)
+    {
+        if (!m_aStaminaThresholds)
+            m_aStaminaThresholds = new array<float>();
+        if (m_aStaminaThresholds.Find(threshold01) < 0)
+            m_aStaminaThresholds.Insert(threshold01);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void RemoveStaminaThreshold(float threshold01)
+    {
+        if (m_aStaminaThresholds)
+            m_aStaminaThresholds.RemoveItem(threshold01);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! tick 末调用：与上一 tick 比较并触发边沿
+    void Evaluate(IEntity entity, float stamina01, bool exhausted, bool wPrimeDepleted, bool sprintBlocked, ERSS_AIStaminaState aiState)
+    {
+        if (!m_bPrimed)
+        {
+            m_bPrimed = true;
+            Remember(stamina01, exhausted, wPrimeDepleted, sprintBlocked, aiState);
+            return;
+        }
+
+        if (m_OnExhaustedChanged && exhausted != m_bLastExhausted)
+            m_OnExhaustedChanged.Invoke(entity, exhausted);
+        if (m_OnWPrimeDepletedChanged && wPrimeDepleted != m_bLastWPrimeDepleted)
+            m_OnWPrimeDepletedChanged.Invoke(entity, wPrimeDepleted);
+        if (m_OnSprintBlockedChanged && sprintBlocked != m_bLastSprintBlocked)
+            m_OnSprintBlockedChanged.Invoke(entity, sprintBlocked);
+        if (m_OnAIStaminaStateChanged && aiState != m_eLastAIState)
+            m_OnAIStaminaStateChanged.Invoke(entity, m_eLastAIState, aiState);
+
+        if (m_OnStaminaThresholdCrossed && m_aStaminaThresholds)
+        {
+            foreach (float threshold : m_aStaminaThresholds)
+            {
+                if (m_fLastStamina < threshold && stamina01 >= threshold)
+                    m_OnStaminaThresholdCrossed.Invoke(entity, threshold, true);
+                else if (m_fLastStamina >= threshold && stamina01 < threshold)
+                    m_OnStaminaThresholdCrossed.Invoke(entity, threshold, false);
+            }
+        }
+
+        Remember(stamina01, exhausted, wPrimeDepleted, sprintBlocked, aiState);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    protected void Remember(float stamina01, bool exhausted, bool wPrimeDepleted, bool sprintBlocked, ERSS_AIStaminaState aiState)
+    {
+        m_fLastStamina = stamina01;
+        m_bLastExhausted = exhausted;
+        m_bLastWPrimeDepleted = wPrimeDepleted;
+        m_bLastSprintBlocked = sprintBlocked;
+        m_eLastAIState = aiState;
+    }
+}
@@ -1,4 +1,5 @@
-//! 呼吸采样：RSS-CPCR Respiratory 轴 + 音量随驱动强弱渐变
+//! 呼吸采样：RSS-CPCR Respiratory 轴；音量在每段采样起播时按驱动强弱取定
+//! 由 SCR_RSS_PresentationClock 在采样节拍与 GetNextEventSec() 处调用，事件之间不轮询音频
 
 class SCR_RSS_BreathSoundDriver
 {
@@ -15,7 +16,7 @@ class SCR_RSS_BreathSoundDriver
     protected bool m_bCycleArmed = false;
     protected bool m_bWindingDown = false;
     protected float m_fDrive01 = 0.0;
-    protected float m_fVolumeSmoothed = 0.0;
+    protected float m_fVolume = 0.0;
     protected int m_iJitterSeed = 1;
 
     //! 本地开关（Settings → Breath Sounds）；默认开，只影响本机
@@ -61,17 +62,7 @@ class SCR_RSS_BreathSoundDriver
                 SCR_RSS_Constants.V6_BREATH_VOL_MAX);
         }
 
-        m_fVolumeSmoothed = SCR_RSS_PresentationAudio.SmoothToward(
-            m_fVolumeSmoothed, volTarget, SCR_RSS_Constants.V6_PRESENTATION_VOL_SMOOTH);
-
-        // IsSoundPlayed==true 表示已结束
-        if (m_AudioHandle != AudioHandle.Invalid)
-        {
-            if (AudioSystem.IsSoundPlayed(m_AudioHandle))
-                m_AudioHandle = AudioHandle.Invalid;
-            else
-                SCR_RSS_PresentationAudio.ApplyVolume(m_AudioHandle, m_fVolumeSmoothed);
-        }
+        m_fVolume = volTarget;
 
         bool wantBreath = false;
         if (m_fDrive01 > audible)
@@ -148,6 +139,14 @@ class SCR_RSS_BreathSoundDriver
         DisarmCycle(true);
     }
 
+    //! @return 下一次吸/呼/休止切换的世界时间（秒）；未武装时 -1
+    float GetNextEventSec()
+    {
+        if (!m_bCycleArmed)
+            return -1.0;
+        return m_fNextTriggerWorldSec;
+    }
+
     protected float PauseAfterInhaleSec(float drive01)
     {
         // 激进：轻喘间隙也更短，极累几乎贴采样
@@ -197,7 +196,7 @@ class SCR_RSS_BreathSoundDriver
         else
             m_AudioHandle = AudioSystem.PlaySound(SOUND_BREATH_OUT);
 
-        SCR_RSS_PresentationAudio.ApplyVolume(m_AudioHandle, m_fVolumeSmoothed);
+        SCR_RSS_PresentationAudio.ApplyVolume(m_AudioHandle, m_fVolume);
     }
 
     protected void DisarmCycle(bool forceStop)
@@ -211,7 +210,7 @@ class SCR_RSS_BreathSoundDriver
             return;
 
         m_fDrive01 = 0.0;
-        m_fVolumeSmoothed = 0.0;
+        m_fVolume = 0.0;
         if (m_AudioHandle != AudioHandle.Invalid)
         {
             if (!AudioSystem.IsSoundPlayed(m_AudioHandle))
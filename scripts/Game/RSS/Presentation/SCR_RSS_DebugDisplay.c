@@ -764,11 +764,7 @@ class SCR_RSS_DebugDisplay
     //! 体力消耗 / ETA 诊断行（Debug 或 HUD Hint 开启时，由批次管理器每秒输出）
     static void OutputStaminaDrainDiagnostics(
         RSS_StaminaDebugOutputParams tick,
-        SCR_CharacterControllerComponent controller,
-        SCR_RSS_EpocState epocState,
-        SCR_RSS_EncumbranceCache encumbranceCache,
-        SCR_RSS_ExerciseTracker exerciseTracker,
-        SCR_RSS_EnvironmentFactor environmentFactor)
+        SCR_CharacterControllerComponent controller)
     {
         if (!tick || !controller)
             return;
@@ -776,25 +772,12 @@ class SCR_RSS_DebugDisplay
         if (!SCR_RSS_DebugBatchManager.IsDebugBatchActive())
             return;
 
-        float recoveryPerTick = SCR_RSS_StaminaNetRate.ComputeRecoveryRatePerTick(
-            tick.staminaPercent,
-            tick.currentSpeed,
-            tick.baseDrainRateByVelocity,
-            tick.baseDrainRateByVelocityForModule,
-            tick.heatStressMultiplier,
-            epocState,
-            encumbranceCache,
-            exerciseTracker,
-            controller,
-            environmentFactor,
-            false);
-
-        float finalDrainPerTick = SCR_RSS_StaminaNetRate.ComputeFinalDrainRatePerTick(
-            tick.useSwimmingModel,
-            tick.currentSpeed,
-            tick.totalDrainRate,
-            epocState,
-            false);
+        // 读协调器本 tick 已发布的速率，不再按调试快照重算
+        StaminaTickRates rates = tick.rates;
+        if (!rates || !rates.valid)
+            return;
+        float recoveryPerTick = rates.recoveryPerTick;
+        float finalDrainPerTick = rates.finalDrainPerTick;
 
         float netPerTick = recoveryPerTick - finalDrainPerTick;
         float tickSec = SCR_RSS_Constants.RSS_STAMINA_TICK_SEC;
@@ -804,20 +787,7 @@ class SCR_RSS_DebugDisplay
         // 超速 STA 税在 UpdateStaminaValue 外叠加，ETA/有效掉条须计入
         if (tick.overspeedExtraDrainPerSec > 0.0)
             drainPerSec = drainPerSec + tick.overspeedExtraDrainPerSec;
-        float netPerSec = SCR_RSS_StaminaNetRate.GetNetStaminaRatePerSecond(
-            tick.staminaPercent,
-            tick.useSwimmingModel,
-            tick.currentSpeed,
-            tick.totalDrainRate,
-            tick.baseDrainRateByVelocity,
-            tick.baseDrainRateByVelocityForModule,
-            tick.heatStressMultiplier,
-            epocState,
-            encumbranceCache,
-            exerciseTracker,
-            controller,
-            environmentFactor,
-            false);
+        float netPerSec = rates.netPerSec;
         if (tick.overspeedExtraDrainPerSec > 0.0)
             netPerSec = netPerSec - tick.overspeedExtraDrainPerSec;
 
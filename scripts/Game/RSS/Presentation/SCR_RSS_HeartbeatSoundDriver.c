@@ -1,4 +1,5 @@
-//! 心跳采样：RSS-CPCR Cardiac 轴；稀疏提醒式爆发 + 音量渐变（不连播）
+//! 心跳采样：RSS-CPCR Cardiac 轴；稀疏提醒式爆发（不连播），音量在每拍起播时取定
+//! 由 SCR_RSS_PresentationClock 在采样节拍与 GetNextEventSec() 处调用，拍与拍之间不轮询音频
 
 class SCR_RSS_HeartbeatSoundDriver
 {
@@ -18,7 +19,7 @@ class SCR_RSS_HeartbeatSoundDriver
     protected float m_fNextTriggerWorldSec = -1.0;
     protected bool m_bArmed = false;
     protected float m_fDrive01 = 0.0;
-    protected float m_fVolumeSmoothed = 0.0;
+    protected float m_fVolume = 0.0;
     protected int m_iBeatsLeftInBurst = 0;
     protected int m_iJitterSeed = 17;
 
@@ -42,17 +43,7 @@ class SCR_RSS_HeartbeatSoundDriver
                 SCR_RSS_Constants.V6_HEARTBEAT_VOL_MAX);
         }
 
-        m_fVolumeSmoothed = SCR_RSS_PresentationAudio.SmoothToward(
-            m_fVolumeSmoothed, volTarget, SCR_RSS_Constants.V6_PRESENTATION_VOL_SMOOTH);
-
-        // IsSoundPlayed==true 表示已结束
-        if (m_AudioHandle != AudioHandle.Invalid)
-        {
-            if (AudioSystem.IsSoundPlayed(m_AudioHandle))
-                m_AudioHandle = AudioHandle.Invalid;
-            else
-                SCR_RSS_PresentationAudio.ApplyVolume(m_AudioHandle, m_fVolumeSmoothed);
-        }
+        m_fVolume = volTarget;
 
         if (m_fDrive01 <= audible)
         {
@@ -82,7 +73,7 @@ class SCR_RSS_HeartbeatSoundDriver
 
         m_iTier = ResolveTier(m_fDrive01, m_iTier);
         float clipSec = PlayTierClip(m_iTier);
-        SCR_RSS_PresentationAudio.ApplyVolume(m_AudioHandle, m_fVolumeSmoothed);
+        SCR_RSS_PresentationAudio.ApplyVolume(m_AudioHandle, m_fVolume);
 
         m_iBeatsLeftInBurst = m_iBeatsLeftInBurst - 1;
         if (m_iBeatsLeftInBurst > 0)
@@ -104,7 +95,7 @@ class SCR_RSS_HeartbeatSoundDriver
         m_iBeatsLeftInBurst = 0;
         m_fNextTriggerWorldSec = -1.0;
         m_fDrive01 = 0.0;
-        m_fVolumeSmoothed = 0.0;
+        m_fVolume = 0.0;
         m_iTier = 0;
         if (m_AudioHandle != AudioHandle.Invalid)
         {
@@ -114,6 +105,14 @@ class SCR_RSS_HeartbeatSoundDriver
         }
     }
 
+    //! @return 下一拍的世界时间（秒）；未武装时 -1
+    float GetNextEventSec()
+    {
+        if (!m_bArmed)
+            return -1.0;
+        return m_fNextTriggerWorldSec;
+    }
+
     protected int ResolveBurstCount(float drive01)
     {
         if (drive01 >= SCR_RSS_Constants.V6_HEARTBEAT_TIER_FAST_ENTER)
@@ -26,13 +26,4 @@ class SCR_RSS_PresentationAudio
             volMax = volMin;
         return volMin + (volMax - volMin) * drive01;
     }
-
-    static float SmoothToward(float current, float target, float alpha)
-    {
-        if (alpha < 0.0)
-            alpha = 0.0;
-        if (alpha > 1.0)
-            alpha = 1.0;
-        return current + (target - current) * alpha;
-    }
 }
@@ -0,0 +1,50 @@
+//! 表现时钟：心/肺轴与呼吸/心跳采样的统一排程
+//!
+//! 心/肺轴按固定节拍采样并推进一次（τ ≥ 4 s，10 Hz 足够跟手）；呼吸/心跳驱动器只在
+//! 自己排定的事件沿（吸/呼/拍）被调用。两者之间的帧只做一次时间比较，不查询音频句柄。
+
+class SCR_RSS_PresentationClock
+{
+    //! 心/肺轴采样间隔（秒）
+    static const float CARDIO_SAMPLE_SEC = 0.1;
+
+    protected float m_fNextSampleSec = -1.0;
+    protected float m_fNextDueSec = -1.0;
+
+    //------------------------------------------------------------------------------------------------
+    //! @return 本帧是否有采样或事件到期（每帧唯一的开销）
+    bool IsDue(float worldTimeSec)
+    {
+        return worldTimeSec + 0.0001 >= m_fNextDueSec;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 采样到期时返回 true 并排下一次采样
+    bool ConsumeSample(float worldTimeSec)
+    {
+        if (worldTimeSec + 0.0001 < m_fNextSampleSec)
+            return false;
+        m_fNextSampleSec = worldTimeSec + CARDIO_SAMPLE_SEC;
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 下一次到期 = 下一次采样与各驱动器下一事件中最早者（<0 表示驱动器空闲）
+    void Schedule(float breathNextSec, float heartbeatNextSec)
+    {
+        float due = m_fNextSampleSec;
+        if (breathNextSec >= 0.0 && breathNextSec < due)
+            due = breathNextSec;
+        if (heartbeatNextSec >= 0.0 && heartbeatNextSec < due)
+            due = heartbeatNextSec;
+        m_fNextDueSec = due;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    //! 下一帧立即采样（驱动器重建、开关切换等）
+    void Reset()
+    {
+        m_fNextSampleSec = -1.0;
+        m_fNextDueSec = -1.0;
+    }
+}
@@ -1,36 +1,105 @@
 #!/usr/bin/env python3
 # -*- coding: utf-8 -*-
 """
-将 v4/v6 优化器导出的 JSON 预设合并写入 SCR_RSS_SettingsPresetBake.c。
-仅覆盖 JSON 中出现的键，其余 Init*Defaults / ApplyV6TierCpDefaults 字段保持原 C 值不变。
+将 v4/v6 优化器导出的 JSON 预设合并写入 SCR_RSS_PresetTable.c（预设参数常量表）。
+
+表布局：每行一个预设，每列一个 SCR_RSS_Params 字段，列序 = PARAM_FIELDS =
+SCR_RSS_SettingsSync.WriteParamsToArray 的写入顺序（网络包 / JSON 平面数组同一布局）。
+仅覆盖 JSON 中出现的键，其余列保留表内现值；Custom 行不由 JSON 驱动，原样保留。
+往返无损校验见 tools/test_preset_table_roundtrip.py。
 """
 
 import json
 import re
 from pathlib import Path
-from typing import Dict, List, Tuple
-
-V6_TIER_BY_PRESET = {
-    'EliteStandard': 0,
-    'StandardMilsim': 1,
-    'TacticalAction': 2,
-}
-
-V6_PARAM_KEYS = {
-    'critical_power_watts',
-    'w_prime_max_joules',
-    'w_prime_recovery_w_per_s',
-    'sprint_power_cap_watts',
+from typing import Dict, List, Optional, Tuple
+
+# 列序：必须与 SCR_RSS_SettingsSync.WriteParamsToArray / ApplyParamsFromArray 一致
+PARAM_FIELDS: Tuple[str, ...] = (
+    'energy_to_stamina_coeff',
+    'base_recovery_rate',
+    'standing_recovery_multiplier',
+    'crouching_recovery_multiplier',
+    'prone_recovery_multiplier',
+    'load_recovery_penalty_coeff',
+    'load_recovery_penalty_exponent',
+    'encumbrance_speed_penalty_coeff',
+    'encumbrance_speed_penalty_exponent',
+    'encumbrance_speed_penalty_max',
+    'encumbrance_stamina_drain_coeff',
+    'load_metabolic_dampening',
+    'max_recovery_per_tick',
+    'sprint_stamina_drain_multiplier',
+    'fatigue_accumulation_coeff',
+    'fatigue_max_factor',
+    'aerobic_efficiency_factor',
+    'anaerobic_efficiency_factor',
+    'recovery_nonlinear_coeff',
+    'fast_recovery_multiplier',
+    'medium_recovery_multiplier',
+    'slow_recovery_multiplier',
+    'marginal_decay_threshold',
+    'marginal_decay_coeff',
+    'min_recovery_stamina_threshold',
+    'min_recovery_rest_time_seconds',
+    'sprint_speed_boost',
+    'sprint_velocity_threshold',
+    'willpower_threshold',
+    'sprint_enable_threshold',
+    'posture_crouch_multiplier',
+    'posture_prone_multiplier',
+    'jump_efficiency',
+    'jump_height_guess',
+    'jump_horizontal_speed_guess',
+    'climb_iso_efficiency',
+    'slope_uphill_coeff',
+    'slope_downhill_coeff',
+    'swimming_base_power',
+    'swimming_encumbrance_threshold',
+    'swimming_static_drain_multiplier',
+    'swimming_dynamic_power_efficiency',
+    'swimming_energy_to_stamina_coeff',
+    'env_heat_stress_max_multiplier',
+    'env_rain_weight_max',
+    'env_wind_resistance_coeff',
+    'env_mud_penalty_max',
+    'env_temperature_heat_penalty_coeff',
+    'env_temperature_cold_recovery_penalty_coeff',
+    'env_surface_wetness_prone_penalty',
+    'sustainable_watts',
     'v5_walk_speed_ms',
     'v5_run_speed_ms',
     'v5_sprint_speed_ms',
+    'anaerobic_sprint_enable_threshold',
     'burst_cooldown_full_seconds',
     'burst_cooldown_short_seconds',
+    'anaerobic_drain_per_sec',
+    'anaerobic_recovery_per_sec',
+    'critical_power_watts',
+    'w_prime_max_joules',
+    'w_prime_recovery_w_per_s',
+    'sprint_power_cap_watts',
+    'w_prime_recovery_mode',
+)
+
+# (预设名, 行常量名)；行下标即 SCR_RSS_PresetTable.PRESET_* 的值
+PRESET_ROWS: Tuple[Tuple[str, str], ...] = (
+    ('EliteStandard', 'ELITE_STANDARD'),
+    ('StandardMilsim', 'STANDARD_MILSIM'),
+    ('TacticalAction', 'TACTICAL_ACTION'),
+    ('Custom', 'CUSTOM'),
+)
+
+# 由 JSON 驱动的系统预设 -> JSON 文件 slug
+JSON_SLUG_BY_PRESET = {
+    'EliteStandard': 'elitestandard',
+    'StandardMilsim': 'standardmilsim',
+    'TacticalAction': 'tacticalaction',
 }
 
 
 def format_c_float(value) -> str:
-    """格式化为 EnforceScript 可解析的浮点字面量。"""
+    """格式化为 EnforceScript 可解析的浮点字面量（float() 回读与原值逐位一致）。"""
     if isinstance(value, bool):
         if value:
             return "1.0"
@@ -38,270 +107,188 @@ def format_c_float(value) -> str:
     if not isinstance(value, (int, float)):
         return str(value)
     v = float(value)
+    if v == 0.0:
+        return "0.0"
     if abs(v) < 0.001 or abs(v) > 10000:
         return f"{v:.16e}"
     return str(v)
 
 
-class JsonToCEmbedder:
-    """JSON 到 SCR_RSS_SettingsPresetBake.c 的合并嵌入器。"""
-
-    def __init__(self, c_file_path: str):
-        self.c_file_path = Path(c_file_path)
-        self.c_content = self.c_file_path.read_text(encoding='utf-8')
-        self.json_data: Dict[str, float] = {}
-        self.json_meta: Dict[str, object] = {}
-
-    def load_json(self, json_file_path: str):
-        json_path = Path(json_file_path)
-        if not json_path.exists():
-            raise FileNotFoundError(f"JSON文件不存在: {json_file_path}")
-
-        with open(json_path, 'r', encoding='utf-8') as f:
-            data = json.load(f)
-
-        # v4: 根级扁平键；旧版: {"parameters": {...}}
-        if isinstance(data.get('parameters'), dict):
-            raw = data['parameters']
-        else:
-            raw = data
-
-        self.json_data = {}
-        self.json_meta = {}
-        for key, value in raw.items():
-            if key.startswith('_'):
-                self.json_meta[key] = value
-            elif isinstance(value, (int, float)):
-                self.json_data[key] = float(value)
-
-        print(f"已加载JSON: {json_file_path}")
-        print(f"  可写入参数: {len(self.json_data)}")
-
-    def _init_method_pattern(self, preset_name: str) -> str:
-        return (
-            r'static void Init' + preset_name
-            + r'Defaults\(SCR_RSS_Settings s, bool shouldInit\)\s*\{'
-            + r'(.*?)'
-            + r'\n\}'
-        )
-
-    def _parse_existing_assignments(
-        self, preset_name: str
-    ) -> Tuple[List[str], Dict[str, str]]:
-        """解析 Init{preset}Defaults 内已有赋值，保留字段顺序。"""
-        match = re.search(
-            self._init_method_pattern(preset_name), self.c_content, re.DOTALL
-        )
-        if not match:
-            return [], {}
-
-        body = match.group(1)
-        field_order: List[str] = []
-        values: Dict[str, str] = {}
-        assign_re = re.compile(
-            rf's\.m_{preset_name}\.(\w+)\s*=\s*([^;]+);'
-        )
-        for m in assign_re.finditer(body):
-            name = m.group(1)
-            if name not in values:
-                field_order.append(name)
-            values[name] = m.group(2).strip()
-        return field_order, values
-
-    def update_preset(self, preset_name: str) -> bool:
-        if not self.json_data:
-            raise ValueError("请先加载JSON文件！")
-
-        print(f"\n正在更新 {preset_name} 预设...")
-        field_order, existing = self._parse_existing_assignments(preset_name)
-        if not field_order:
-            print(f"警告：未找到 Init{preset_name}Defaults")
-            return False
-
-        merged = dict(existing)
-        updated_keys = []
-        v6_overrides = {}
-        for key, value in self.json_data.items():
-            formatted = format_c_float(value)
-            if key in V6_PARAM_KEYS:
-                v6_overrides[key] = formatted
-                updated_keys.append(key)
-                continue
-            merged[key] = formatted
-            if key not in existing or existing.get(key) != merged[key]:
-                updated_keys.append(key)
-            if key not in field_order:
-                field_order.append(key)
-
-        philosophy = self.json_meta.get('_philosophy', '')
-        metrics = self.json_meta.get('_metrics_v6')
-        if metrics is None:
-            metrics = self.json_meta.get('_metrics')
+def load_preset_json(json_file_path) -> Tuple[Dict[str, float], Dict[str, object]]:
+    """读取优化器 JSON，返回 (数值参数, 以 '_' 开头的元数据)。"""
+    json_path = Path(json_file_path)
+    if not json_path.exists():
+        raise FileNotFoundError(f"JSON文件不存在: {json_file_path}")
+
+    with open(json_path, 'r', encoding='utf-8') as f:
+        data = json.load(f)
+
+    # v4: 根级扁平键；旧版: {"parameters": {...}}
+    if isinstance(data.get('parameters'), dict):
+        raw = data['parameters']
+    else:
+        raw = data
+
+    params: Dict[str, float] = {}
+    meta: Dict[str, object] = {}
+    for key, value in raw.items():
+        if key.startswith('_'):
+            meta[key] = value
+        elif isinstance(value, (int, float)):
+            params[key] = float(value)
+    return params, meta
+
+
+def merge_json_into_row(row: List[float], params: Dict[str, float]) -> List[str]:
+    """JSON 参数覆盖到行内；返回被更新的列名。未知键忽略。
+
+    可持续功率锚定 CP（与旧 ApplyV6TierCpDefaults 的 sustainable_watts = critical_power_watts 一致）。
+    """
+    updated: List[str] = []
+    for key, value in params.items():
+        if key not in PARAM_FIELDS:
+            continue
+        col = PARAM_FIELDS.index(key)
+        if row[col] != value:
+            updated.append(key)
+        row[col] = value
+    if 'critical_power_watts' in params:
+        row[PARAM_FIELDS.index('sustainable_watts')] = params['critical_power_watts']
+    return updated
+
+
+def row_to_json(row: List[float]) -> Dict[str, float]:
+    return {key: row[i] for i, key in enumerate(PARAM_FIELDS)}
+
+
+def header_from_meta(preset_name: str, meta: Dict[str, object], v6: bool) -> List[str]:
+    version_tag = 'v4'
+    if v6:
         version_tag = 'v6'
-        if not v6_overrides:
-            version_tag = 'v4'
-        header_lines = [f"\t// {preset_name} — {version_tag} optimizer merge"]
-        if philosophy:
-            header_lines.append(f"\t// {philosophy}")
-        if isinstance(metrics, dict):
-            cr = metrics.get(
-                'combat_ease',
-                metrics.get('combat_reserve', metrics.get('combat_endurance')),
-            )
-            rp = metrics.get(
-                'recovery_ease',
-                metrics.get('recovery_pace', metrics.get('recovery_efficiency')),
-            )
-            pr = metrics.get('parameter_realism', metrics.get('param_drift'))
-            if all(isinstance(x, (int, float)) for x in (cr, rp, pr)):
-                header_lines.append(
-                    f"\t// metrics: ease={cr:.4f} recovery={rp:.6f} realism={pr:.4f}"
-                )
-
-        assignments = []
-        for key in field_order:
-            if key not in merged:
-                continue
-            if key in V6_PARAM_KEYS:
-                continue
-            assignments.append(
-                f"\ts.m_{preset_name}.{key} = {merged[key]};"
-            )
-
-        tier = V6_TIER_BY_PRESET.get(preset_name, 0)
-        tail_lines = [
-            f"\tApplyV6TierCpDefaults(s.m_{preset_name}, {tier});"
-        ]
-        for key in sorted(v6_overrides.keys()):
-            tail_lines.append(
-                f"\ts.m_{preset_name}.{key} = {v6_overrides[key]};"
-            )
-
-        new_method = (
-            f"static void Init{preset_name}Defaults("
-            f"SCR_RSS_Settings s, bool shouldInit)\n"
-            f"{{\n"
-            f"\tif (!shouldInit)\n"
-            f"\t\treturn;\n"
-            f"\n"
-            + "\n".join(header_lines)
-            + "\n"
-            + "\n".join(assignments)
-            + "\n"
-            + "\n".join(tail_lines)
-            + "\n}"
+    lines = [f"{preset_name} — {version_tag} optimizer merge"]
+    philosophy = meta.get('_philosophy', '')
+    if philosophy:
+        lines.append(str(philosophy))
+    metrics = meta.get('_metrics_v6')
+    if metrics is None:
+        metrics = meta.get('_metrics')
+    if isinstance(metrics, dict):
+        cr = metrics.get(
+            'combat_ease',
+            metrics.get('combat_reserve', metrics.get('combat_endurance')),
         )
-
-        old_pattern = (
-            r'static void Init' + preset_name
-            + r'Defaults\(SCR_RSS_Settings s, bool shouldInit\)\s*\{.*?\n\}'
-        )
-        self.c_content, n = re.subn(
-            old_pattern, new_method, self.c_content, count=1, flags=re.DOTALL
+        rp = metrics.get(
+            'recovery_ease',
+            metrics.get('recovery_pace', metrics.get('recovery_efficiency')),
         )
-        if n != 1:
-            print(f"警告：替换 Init{preset_name}Defaults 失败 (n={n})")
-            return False
-
-        print(f"  已合并 {len(updated_keys)} 个优化参数: {', '.join(updated_keys)}")
-        print(
-            f"  保留 {len(field_order) - len(updated_keys)} 个未在 JSON 中的 C 端字段"
-        )
-        return True
-
-    def _apply_v6_method_span(self) -> Tuple[int, int]:
-        """返回 ApplyV6TierCpDefaults 方法体在文件中的 [start, end)。"""
-        match = re.search(
-            r'static void ApplyV6TierCpDefaults\(SCR_RSS_Params p, int tier\)\s*\{',
-            self.c_content,
+        pr = metrics.get('parameter_realism', metrics.get('param_drift'))
+        if all(isinstance(x, (int, float)) for x in (cr, rp, pr)):
+            lines.append(f"metrics: ease={cr:.4f} recovery={rp:.6f} realism={pr:.4f}")
+    return lines
+
+
+def parse_table(c_text: str) -> Tuple[Dict[str, List[float]], Dict[str, List[str]]]:
+    """解析 SCR_RSS_PresetTable.c，返回 ({预设名: 行}, {预设名: 行前注释})。"""
+    rows: Dict[str, List[float]] = {}
+    headers: Dict[str, List[str]] = {}
+    for preset_name, const_name in PRESET_ROWS:
+        m = re.search(
+            r'((?:[ \t]*//[^\n]*\n)*)[ \t]*static const float ' + const_name
+            + r'\[PARAM_COUNT\]\s*=\s*\{(.*?)\};',
+            c_text,
+            re.DOTALL,
         )
-        if not match:
-            return -1, -1
-        body_start = match.end()
-        depth = 1
-        i = body_start
-        while i < len(self.c_content) and depth > 0:
-            ch = self.c_content[i]
-            if ch == '{':
-                depth += 1
-            elif ch == '}':
-                depth -= 1
-            i += 1
-        if depth != 0:
-            return -1, -1
-        return body_start, i - 1
-
-    def _extract_v6_tier_block(self, tier: int) -> Tuple[str, int, int]:
-        """返回 ApplyV6TierCpDefaults 中指定 tier 代码块 (text, start, end)。"""
-        method_start, method_end = self._apply_v6_method_span()
-        if method_start < 0:
-            return '', -1, -1
-        method_body = self.c_content[method_start:method_end]
-
-        if tier == 0:
-            pattern = r'(if \(tier == 0\)\s*\{)(.*?)(\}\s*else if \(tier == 1\))'
-        elif tier == 1:
-            pattern = (
-                r'(else if \(tier == 1\)\s*\{)(.*?)(\}\s*else\s*\{)'
-            )
-        else:
-            pattern = r'(else\s*\{)(.*?)(\}\s*p\.sustainable_watts)'
-        match = re.search(pattern, method_body, re.DOTALL)
-        if not match:
-            return '', -1, -1
-        start = method_start + match.start(2)
-        end = method_start + match.end(2)
-        return match.group(2), start, end
-
-    def update_v6_tier_params(self, tier: int) -> bool:
-        """将 v6 CP/W'/v5 速度参数写入 ApplyV6TierCpDefaults 对应 tier 块。"""
-        v6_updates = {
-            k: v for k, v in self.json_data.items() if k in V6_PARAM_KEYS
-        }
-        if not v6_updates:
-            print(f"  v6 tier {tier}: JSON 中无 v6 参数字段，跳过")
-            return True
-
-        block, start, end = self._extract_v6_tier_block(tier)
-        if start < 0:
-            print(f"  警告：未找到 ApplyV6TierCpDefaults tier={tier} 代码块")
-            return False
-
-        updated_keys = []
-        new_block = block
-        for key, value in v6_updates.items():
-            formatted = format_c_float(value)
-            # PresetBake 使用空格缩进；兼容 tab。
-            assign_re = re.compile(rf'(\s*p\.{key}\s*=\s*)([^;]+)(;)')
-            if assign_re.search(new_block):
-                new_block = assign_re.sub(
-                    rf'\g<1>{formatted}\g<3>', new_block, count=1
-                )
-                updated_keys.append(key)
-
-        if not updated_keys:
-            print(f"  警告：tier {tier} 块内未匹配到任何 v6 字段")
-            return False
-
-        self.c_content = self.c_content[:start] + new_block + self.c_content[end:]
-        print(
-            f"  v6 tier {tier}: 已合并 {len(updated_keys)} 个参数 "
-            f"({', '.join(updated_keys)})"
-        )
-        return True
-
-    def save_c_file(self, backup: bool = True):
-        if backup:
-            backup_path = self.c_file_path.with_suffix('.c.backup')
-            backup_path.write_text(
-                self.c_file_path.read_text(encoding='utf-8'), encoding='utf-8'
-            )
-            print(f"\n已创建备份: {backup_path}")
-        self.c_file_path.write_text(self.c_content, encoding='utf-8')
-        print(f"已保存: {self.c_file_path}")
-
-
-def _resolve_preset_json(project_root: Path, slug: str) -> Path:
+        if not m:
+            continue
+        headers[preset_name] = [
+            re.sub(r'^\s*//\s?', '', line)
+            for line in m.group(1).splitlines()
+            if line.strip()
+        ]
+        values: List[float] = []
+        for line in m.group(2).splitlines():
+            code = line.split('//', 1)[0].strip().rstrip(',')
+            if code:
+                values.append(float(code))
+        rows[preset_name] = values
+    return rows, headers
+
+
+def render_table(rows: Dict[str, List[float]], headers: Dict[str, List[str]]) -> str:
+    """生成 SCR_RSS_PresetTable.c 全文。"""
+    out: List[str] = [
+        "//! 预设参数常量表 —— 由 tools/embed_json_to_c.py 生成，勿手改",
+        "//!",
+        "//! 每行一个预设，每列一个 SCR_RSS_Params 字段；列序与 SCR_RSS_SettingsSync.WriteParamsToArray 一致，",
+        "//! 预设实例化即整行经 ApplyParamsFromArray 拷入，与网络包 / JSON 平面数组共用同一布局。",
+        "",
+        "class SCR_RSS_PresetTable",
+        "{",
+        f"    static const int PARAM_COUNT = {len(PARAM_FIELDS)};",
+        "",
+    ]
+    for index, (_, const_name) in enumerate(PRESET_ROWS):
+        out.append(f"    static const int PRESET_{const_name} = {index};")
+    out.append("")
+
+    for preset_name, const_name in PRESET_ROWS:
+        row = rows[preset_name]
+        if len(row) != len(PARAM_FIELDS):
+            raise ValueError(f"{preset_name}: 行宽 {len(row)} != {len(PARAM_FIELDS)}")
+        for line in headers.get(preset_name, []):
+            out.append(f"    // {line}".rstrip())
+        out.append(f"    static const float {const_name}[PARAM_COUNT] = {{")
+        for i, key in enumerate(PARAM_FIELDS):
+            sep = ","
+            if i == len(PARAM_FIELDS) - 1:
+                sep = ""
+            out.append(f"        {format_c_float(row[i])}{sep} // {key}")
+        out.append("    };")
+        out.append("")
+
+    out.extend([
+        "    protected static ref array<float> s_aRowScratch;",
+        "",
+        "    //------------------------------------------------------------------------------------------------",
+        "    //! 整行拷入 p（preset 为 PRESET_*）",
+        "    static void CopyToParams(int preset, SCR_RSS_Params p)",
+        "    {",
+        "        if (!p)",
+        "            return;",
+        "        if (!s_aRowScratch)",
+        "            s_aRowScratch = new array<float>();",
+        "        s_aRowScratch.Resize(PARAM_COUNT);",
+        "",
+        "        int i;",
+    ])
+    for index, (_, const_name) in enumerate(PRESET_ROWS):
+        keyword = "if"
+        if index > 0:
+            keyword = "else if"
+        out.extend([
+            f"        {keyword} (preset == PRESET_{const_name})",
+            "        {",
+            "            for (i = 0; i < PARAM_COUNT; i++)",
+            "            {",
+            f"                s_aRowScratch[i] = {const_name}[i];",
+            "            }",
+            "        }",
+        ])
+    out.extend([
+        "        else",
+        "        {",
+        "            return;",
+        "        }",
+        "",
+        "        SCR_RSS_SettingsSync.ApplyParamsFromArray(p, s_aRowScratch);",
+        "    }",
+        "}",
+        "",
+    ])
+    return "\n".join(out)
+
+
+def resolve_preset_json(project_root: Path, slug: str) -> Path:
     """优先 v6 JSON，回退 v4。"""
     tools = project_root / 'tools'
     v6 = tools / f'optimized_rss_config_{slug}_v6.json'
@@ -311,9 +298,26 @@ def _resolve_preset_json(project_root: Path, slug: str) -> Path:
     return v4
 
 
-def main():
+def embed(c_text: str, json_by_preset: Dict[str, Path]) -> Tuple[str, Dict[str, List[str]]]:
+    """把各预设 JSON 合并进表文本，返回 (新文本, {预设名: 更新的列})。"""
+    rows, headers = parse_table(c_text)
+    for preset_name, _ in PRESET_ROWS:
+        if preset_name not in rows:
+            raise ValueError(f"表内缺少 {preset_name} 行")
+
+    updates: Dict[str, List[str]] = {}
+    for preset_name, json_path in json_by_preset.items():
+        params, meta = load_preset_json(json_path)
+        updates[preset_name] = merge_json_into_row(rows[preset_name], params)
+        headers[preset_name] = header_from_meta(
+            preset_name, meta, 'critical_power_watts' in params
+        )
+    return render_table(rows, headers), updates
+
+
+def main(argv: Optional[List[str]] = None) -> int:
     print("=" * 80)
-    print("JSON 配置合并嵌入 SCR_RSS_SettingsPresetBake.c")
+    print("JSON 配置合并嵌入 SCR_RSS_PresetTable.c")
     print("=" * 80)
 
     project_root = Path(__file__).parent.parent
@@ -323,13 +327,12 @@ def main():
         / "Game"
         / "RSS"
         / "NetworkConfig"
-        / "SCR_RSS_SettingsPresetBake.c"
+        / "SCR_RSS_PresetTable.c"
     )
 
     json_files = {
-        'EliteStandard': _resolve_preset_json(project_root, 'elitestandard'),
-        'StandardMilsim': _resolve_preset_json(project_root, 'standardmilsim'),
-        'TacticalAction': _resolve_preset_json(project_root, 'tacticalaction'),
+        name: resolve_preset_json(project_root, slug)
+        for name, slug in JSON_SLUG_BY_PRESET.items()
     }
 
     print("\n检查文件...")
@@ -345,23 +348,18 @@ def main():
         return 1
 
     print("所有文件检查通过。")
-    embedder = JsonToCEmbedder(str(c_file_path))
-
-    for preset_name, json_path in json_files.items():
-        print(f"\n--- {preset_name} ---")
-        try:
-            embedder.load_json(str(json_path))
-            embedder.update_preset(preset_name)
-            tier = V6_TIER_BY_PRESET.get(preset_name)
-            if tier is not None:
-                embedder.update_v6_tier_params(tier)
-        except Exception as exc:
-            print(f"错误：{preset_name}: {exc}")
-            return 1
-
-    print("\n" + "=" * 80)
-    embedder.save_c_file(backup=True)
-    print("完成。请检查 SCR_RSS_SettingsPresetBake.c diff 后在 Workbench 编译验证。")
+    try:
+        new_text, updates = embed(c_file_path.read_text(encoding='utf-8'), json_files)
+    except Exception as exc:
+        print(f"错误：{exc}")
+        return 1
+
+    for preset_name, keys in updates.items():
+        print(f"  {preset_name}: {len(keys)} 列变化 {', '.join(keys)}")
+
+    c_file_path.write_text(new_text, encoding='utf-8')
+    print(f"\n已保存: {c_file_path}")
+    print("完成。请检查 SCR_RSS_PresetTable.c diff 后在 Workbench 编译验证。")
     print("=" * 80)
     return 0
 
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+读取 EnforceScript 源码供 tools/test_*.py 校验：常量取值、方法体、调用链。
+
+测试直接对仓库内 .c 断言，不在 Python 里复制常量或逻辑。
+"""
+
+from __future__ import annotations
+
+import re
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+GAME_SCRIPTS = ROOT / "scripts" / "Game"
+
+
+def strip_comments(text: str) -> str:
+    """去掉 // 与 /* */ 注释（字符串字面量原样保留）。"""
+    out: list[str] = []
+    i = 0
+    n = len(text)
+    in_string = False
+    while i < n:
+        ch = text[i]
+        if in_string:
+            out.append(ch)
+            if ch == "\\" and i + 1 < n:
+                out.append(text[i + 1])
+                i += 2
+                continue
+            if ch == '"':
+                in_string = False
+            i += 1
+            continue
+        if ch == '"':
+            in_string = True
+            out.append(ch)
+            i += 1
+            continue
+        if text.startswith("//", i):
+            end = text.find("\n", i)
+            i = n if end < 0 else end
+            continue
+        if text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            i = n if end < 0 else end + 2
+            continue
+        out.append(ch)
+        i += 1
+    return "".join(out)
+
+
+def read_script(relative: str) -> str:
+    """scripts/Game 下的脚本（已去注释）。"""
+    return strip_comments((GAME_SCRIPTS / relative).read_text(encoding="utf-8"))
+
+
+def static_const(text: str, name: str) -> float:
+    """`static const float/int NAME = <数字>;` 的取值；不是数字字面量时报错。"""
+    m = re.search(r"\bstatic\s+const\s+(?:float|int)\s+" + re.escape(name) + r"\s*=\s*([^;]+);", text)
+    if not m:
+        raise KeyError(f"static const {name} not found")
+    literal = m.group(1).strip()
+    try:
+        return float(literal)
+    except ValueError as exc:
+        raise ValueError(f"{name} = {literal} is not a numeric literal") from exc
+
+
+def _match_brace(text: str, open_idx: int) -> int:
+    depth = 0
+    for i in range(open_idx, len(text)):
+        if text[i] == "{":
+            depth += 1
+        elif text[i] == "}":
+            depth -= 1
+            if depth == 0:
+                return i
+    raise ValueError("unbalanced braces")
+
+
+def method_body(text: str, name: str, occurrence: int = 0) -> str:
+    """方法定义 `<类型> NAME(...) { ... }` 的方法体（不含外层花括号）；occurrence 选重载。"""
+    pattern = re.compile(r"^[ \t]*(?:[\w<>,]+[ \t]+)+" + re.escape(name) + r"\s*\(", re.MULTILINE)
+    found = 0
+    for m in pattern.finditer(text):
+        depth = 0
+        i = m.end() - 1
+        while i < len(text):
+            if text[i] == "(":
+                depth += 1
+            elif text[i] == ")":
+                depth -= 1
+                if depth == 0:
+                    break
+            i += 1
+        rest = text[i + 1 :].lstrip()
+        if not rest.startswith("{"):
+            continue
+        if found == occurrence:
+            open_idx = len(text) - len(rest)
+            return text[open_idx + 1 : _match_brace(text, open_idx)]
+        found += 1
+    raise KeyError(f"method {name} not found")
+
+
+def calls(body: str, callee: str) -> bool:
+    """方法体内是否调用 callee（允许 `obj.` / `Class.` 前缀）。"""
+    return re.search(r"(?<![\w])" + re.escape(callee) + r"\s*\(", body) is not None
@@ -232,7 +232,7 @@ class RSSConstants:
     SLOPE_UPHILL_COEFF = 0.08
     SLOPE_DOWNHILL_COEFF = 0.03
 
-    # v5/v6 绝对速度档（与 SCR_RSS_Params / ApplyV6TierCpDefaults 一致）
+    # v5/v6 绝对速度档（与 SCR_RSS_Params / SCR_RSS_PresetTable 一致）
     V5_WALK_SPEED_MS = V5_WALK_SPEED_MS_DEFAULT
     V5_RUN_SPEED_MS = V5_RUN_SPEED_MS_DEFAULT
     V5_SPRINT_SPEED_MS = V5_SPRINT_SPEED_MS_DEFAULT
@@ -1453,7 +1453,7 @@ def _maybe_embed_c(embed: bool) -> int:
     if not embed_script.exists():
         print("[V6] embed_json_to_c.py not found, skip --embed-c")
         return 0
-    print("[V6] embedding presets into SCR_RSS_SettingsPresetBake.c ...")
+    print("[V6] embedding presets into SCR_RSS_PresetTable.c ...")
     return int(subprocess.call([sys.executable, str(embed_script)]))
 
 
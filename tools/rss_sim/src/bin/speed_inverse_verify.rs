@@ -0,0 +1,156 @@
+//! 功率→速度反解查表校验：SpeedInverseTable（游戏 SCR_RSS_SpeedInverseTable.c 的镜像）vs 24 步二分
+//!
+//! 目标功率取 compute_cp_watts 的 CP 巡航区间。上下文两组：坡度/负重/地形网格（恰在量化点上），
+//! 以及确定性随机的离网上下文（负重/坡度/地形连续取值，建表按量化值、求解按实际值，覆盖量化偏移）。
+//! 统计“规则查询”（单一连续交点）的速度/功率误差与守护单元占比；分支不一致（|Δv| > 一格）
+//! 逐条报告，其表解功率残差须在容差内（落在另一个合法交点上），且占比不超过 MAX_BRANCH_MISS_SHARE。
+//!
+//! cargo run --manifest-path tools/rss_sim/Cargo.toml --bin speed_inverse_verify --no-default-features --release
+
+use rss_sim::metabolism::{compute_cp_watts, invert_speed_for_power_watts, metabolism_power_watts};
+use rss_sim::speed_inverse::{
+    is_regular_query, power_tolerance_watts, quantize, SpeedInverseTable, FORWARD_NODES, FORWARD_SPEED_STEP_MS,
+    GRADE_QUANT_PCT, SPEED_TOL_MS, TERRAIN_QUANT, WEIGHT_QUANT_KG,
+};
+
+const BODY: f64 = 90.0;
+const DAMPENING: f64 = 0.70;
+const CP0_LEVELS: [f64; 4] = [350.0, 550.0, 750.0, 941.7155709077625];
+const FATIGUE_LEVELS: [f64; 3] = [0.0, 0.4, 0.8];
+const MAX_BRANCH_MISS_SHARE: f64 = 0.005;
+const OFF_GRID_CONTEXTS_PER_PHASE: usize = 4000;
+const MAX_REPORTED_MISSES: usize = 20;
+
+/// Deterministic LCG so the off-grid sweep is reproducible without extra dependencies.
+struct Lcg(u64);
+
+impl Lcg {
+    fn next_f64(&mut self) -> f64 {
+        self.0 = self.0.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+        (self.0 >> 11) as f64 / (1u64 << 53) as f64
+    }
+
+    fn uniform(&mut self, lo: f64, hi: f64) -> f64 {
+        lo + (hi - lo) * self.next_f64()
+    }
+}
+
+/// Whether power crosses `target` within `SPEED_TOL_MS` of `v`: at most the target on the left,
+/// at least it on the right. Slack is the power tolerance plus the quantisation offset at `v`
+/// (the table descends on the quantised context, so near a tangent it may see a crossing the
+/// exact curve only just misses).
+fn brackets_crossing(v: f64, target: f64, total: f64, grade: f64, terrain: f64, phase: i32) -> bool {
+    let quantised = metabolism_power_watts(
+        v,
+        quantize(total, WEIGHT_QUANT_KG),
+        quantize(grade, GRADE_QUANT_PCT),
+        quantize(terrain, TERRAIN_QUANT),
+        phase,
+    );
+    let slack = power_tolerance_watts(target) + (quantised - metabolism_power_watts(v, total, grade, terrain, phase)).abs();
+    let p_left = metabolism_power_watts((v - SPEED_TOL_MS).max(0.0), total, grade, terrain, phase);
+    let p_right = metabolism_power_watts(v + SPEED_TOL_MS, total, grade, terrain, phase);
+    p_left <= target + slack && p_right >= target - slack
+}
+
+#[derive(Default)]
+struct Stats {
+    queries: usize,
+    regular: usize,
+    out_of_tol: usize,
+    branch_misses: usize,
+    guarded_cells: usize,
+    tables: usize,
+    worst_dv: f64,
+    worst_case: String,
+}
+
+impl Stats {
+    fn check_context(&mut self, phase: i32, load_kg: f64, grade: f64, terrain: f64) {
+        let total = BODY + load_kg;
+        let table = SpeedInverseTable::build(total, grade, terrain, phase, DAMPENING);
+        self.tables += 1;
+        self.guarded_cells += table.guarded_cells();
+        for &cp0 in &CP0_LEVELS {
+            for &fatigue in &FATIGUE_LEVELS {
+                let cp = compute_cp_watts(cp0, load_kg, grade, 1.0, fatigue);
+                let exact = invert_speed_for_power_watts(cp, total, grade, terrain, phase);
+                let tabled = table.lookup(cp, total, grade, terrain, phase, DAMPENING);
+                let dv = (exact - tabled).abs();
+                self.queries += 1;
+                let case = format!(
+                    "phase={phase} load={load_kg:.3} grade={grade:.3} terrain={terrain:.3} cp={cp:.1} \
+                     bisection={exact:.4} table={tabled:.4}"
+                );
+                let residual = (metabolism_power_watts(tabled, total, grade, terrain, phase) - cp).abs();
+                if dv > FORWARD_SPEED_STEP_MS {
+                    // Non-monotone curve: the table may settle on another crossing than the
+                    // bisection. It must still bracket one (possibly through a jump), or the miss
+                    // is a real error.
+                    self.branch_misses += 1;
+                    if !brackets_crossing(tabled, cp, total, grade, terrain, phase) {
+                        self.out_of_tol += 1;
+                        println!("[FAIL] branch miss off every crossing: {case} residual={residual:.2}W");
+                    } else if self.branch_misses <= MAX_REPORTED_MISSES {
+                        println!("[MISS] {case} residual={residual:.2}W");
+                    }
+                    continue;
+                }
+                if !is_regular_query(cp, total, grade, terrain, phase, DAMPENING) {
+                    continue;
+                }
+                self.regular += 1;
+                if dv > SPEED_TOL_MS && residual > power_tolerance_watts(cp) {
+                    self.out_of_tol += 1;
+                    println!("[FAIL] {case} residual={residual:.2}W");
+                }
+                if dv > self.worst_dv {
+                    self.worst_dv = dv;
+                    self.worst_case = case;
+                }
+            }
+        }
+    }
+
+    /// Prints the summary; returns false when the sweep fails.
+    fn report(&self, label: &str) -> bool {
+        let miss_share = self.branch_misses as f64 / self.queries as f64;
+        let guarded_share = self.guarded_cells as f64 / (self.tables * (FORWARD_NODES - 1)) as f64;
+        println!("[{label}] queries={} regular={} out_of_tol={}", self.queries, self.regular, self.out_of_tol);
+        println!("[{label}] worst_dv={:.5} m/s ({})", self.worst_dv, self.worst_case);
+        println!("[{label}] branch_misses={} ({:.3}%)", self.branch_misses, miss_share * 100.0);
+        println!("[{label}] guarded_cells={:.2}%", guarded_share * 100.0);
+        self.out_of_tol == 0 && miss_share <= MAX_BRANCH_MISS_SHARE
+    }
+}
+
+fn main() {
+    let mut on_grid = Stats::default();
+    for phase in 1..=3 {
+        for load_i in 0..=12 {
+            for grade_i in -12..=12 {
+                for &terrain in &[1.0, 1.3, 1.8, 2.4] {
+                    on_grid.check_context(phase, load_i as f64 * 5.0, grade_i as f64 * 2.5, terrain);
+                }
+            }
+        }
+    }
+
+    let mut off_grid = Stats::default();
+    let mut rng = Lcg(0x5eed_0030);
+    for phase in 1..=3 {
+        for _ in 0..OFF_GRID_CONTEXTS_PER_PHASE {
+            let load_kg = rng.uniform(0.0, 60.0);
+            let grade = rng.uniform(-30.0, 30.0);
+            let terrain = rng.uniform(1.0, 2.5);
+            off_grid.check_context(phase, load_kg, grade, terrain);
+        }
+    }
+
+    let on_grid_ok = on_grid.report("on-grid");
+    let off_grid_ok = off_grid.report("off-grid");
+    if !on_grid_ok || !off_grid_ok {
+        std::process::exit(1);
+    }
+    println!("[OK] speed inverse table agrees with bisection");
+}
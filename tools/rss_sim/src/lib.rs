@@ -12,7 +12,9 @@ pub mod environment;
 pub mod fatigue;
 pub mod math;
 pub mod metabolism;
+pub mod metabolism_table;
 pub mod mission;
+pub mod speed_inverse;
 pub mod twin;
 
 use constants::{merge_game_aligned_params, RssConstants};
@@ -0,0 +1,252 @@
+//! Mirror of `SCR_RSS_MetabolismTable.c`: multilinear lookup over (phase class, total weight,
+//! grade, speed) with two terrain planes, plus the cell guard that falls back to the exact model.
+//! The tests below check the in-game error bound against `metabolism::metabolism_power_watts_damped`.
+
+use crate::constants::LCDA_MAX_SPEED_MS;
+use crate::math::clip_f64;
+use crate::metabolism::metabolism_power_watts_damped;
+
+pub const SPEED_MIN_MS: f64 = 0.1;
+pub const SPEED_STEP_MS: f64 = 0.1;
+pub const SPEED_NODES: usize = 60;
+pub const GRADE_MIN_PCT: f64 = -30.0;
+pub const GRADE_STEP_PCT: f64 = 1.0;
+pub const GRADE_NODES: usize = 61;
+pub const WEIGHT_MIN_KG: f64 = 90.0;
+pub const WEIGHT_STEP_KG: f64 = 5.0;
+pub const WEIGHT_NODES: usize = 13;
+pub const PHASE_CLASSES: usize = 3;
+pub const TERRAIN_PLANES: usize = 2;
+
+pub const ABS_TOL_W: f64 = 2.0;
+pub const REL_TOL: f64 = 0.01;
+
+/// Cell-guard probe points `(a, b)` in cell-local coordinates (speed, grade): centre and the four
+/// edge midpoints. Same order as `IsCellTabled` in the game script.
+const GUARD_PROBES: [(f64, f64); 5] = [(0.5, 0.5), (0.5, 0.0), (0.5, 1.0), (0.0, 0.5), (1.0, 0.5)];
+
+/// Terrain factors the guard compares at: the lookup clamp range ends and the two planes. The
+/// max(0) clamps make power piecewise linear in terrain, so the plane extrapolation is checked too.
+pub const TERRAIN_MIN: f64 = 0.5;
+pub const TERRAIN_MAX: f64 = 3.0;
+const GUARD_TERRAINS: [f64; 4] = [TERRAIN_MIN, 1.0, 2.0, TERRAIN_MAX];
+
+const BODY_WEIGHT_KG: f64 = 90.0;
+const GENTLE_DOWNHILL_GRADE_MAX: f64 = 12.0;
+
+pub fn tolerance_watts(exact_w: f64) -> f64 {
+    ABS_TOL_W.max(REL_TOL * exact_w.abs())
+}
+
+fn phase_class_of(movement_phase: i32) -> Option<usize> {
+    match movement_phase {
+        0 | 1 => Some(0),
+        2 => Some(1),
+        3 => Some(2),
+        _ => None,
+    }
+}
+
+fn cell_crosses_discontinuity(phase_class: usize, iv: usize, ig: usize) -> bool {
+    let v_lo = SPEED_MIN_MS + iv as f64 * SPEED_STEP_MS;
+    if phase_class == 0 && v_lo <= LCDA_MAX_SPEED_MS && LCDA_MAX_SPEED_MS <= v_lo + SPEED_STEP_MS {
+        return true;
+    }
+    let g_lo = GRADE_MIN_PCT + ig as f64 * GRADE_STEP_PCT;
+    let gentle_edge = -GENTLE_DOWNHILL_GRADE_MAX;
+    g_lo <= gentle_edge && gentle_edge <= g_lo + GRADE_STEP_PCT
+}
+
+/// Eagerly built equivalent of the lazily filled in-game table.
+pub struct MetabolismTable {
+    dampening: f64,
+    nodes: Vec<f64>,
+    cell_tabled: Vec<bool>,
+}
+
+impl MetabolismTable {
+    pub fn build(load_metabolic_dampening: f64) -> Self {
+        let mut table = MetabolismTable {
+            dampening: load_metabolic_dampening,
+            nodes: vec![0.0; PHASE_CLASSES * WEIGHT_NODES * TERRAIN_PLANES * GRADE_NODES * SPEED_NODES],
+            cell_tabled: vec![false; PHASE_CLASSES * WEIGHT_NODES * (GRADE_NODES - 1) * (SPEED_NODES - 1)],
+        };
+        for pc in 0..PHASE_CLASSES {
+            for iw in 0..WEIGHT_NODES {
+                for plane in 0..TERRAIN_PLANES {
+                    for ig in 0..GRADE_NODES {
+                        for iv in 0..SPEED_NODES {
+                            let v = SPEED_MIN_MS + iv as f64 * SPEED_STEP_MS;
+                            let g = GRADE_MIN_PCT + ig as f64 * GRADE_STEP_PCT;
+                            let idx = table.node_index(pc, iw, plane, iv, ig);
+                            table.nodes[idx] = table.exact(pc, iw, 1.0 + plane as f64, v, g);
+                        }
+                    }
+                }
+                for ig in 0..GRADE_NODES - 1 {
+                    for iv in 0..SPEED_NODES - 1 {
+                        let ok = !cell_crosses_discontinuity(pc, iv, ig)
+                            && GUARD_PROBES.iter().all(|&(a, b)| {
+                                let p1 = table.bilinear(pc, iw, 0, iv, ig, a, b);
+                                let p2 = table.bilinear(pc, iw, 1, iv, ig, a, b);
+                                let v = SPEED_MIN_MS + (iv as f64 + a) * SPEED_STEP_MS;
+                                let g = GRADE_MIN_PCT + (ig as f64 + b) * GRADE_STEP_PCT;
+                                GUARD_TERRAINS.iter().all(|&t| {
+                                    let interp = (p1 + (p2 - p1) * (t - 1.0)).max(0.0);
+                                    let exact = table.exact(pc, iw, t, v, g);
+                                    (interp - exact).abs() <= 0.5 * tolerance_watts(exact)
+                                })
+                            });
+                        let idx = table.cell_index(pc, iw, iv, ig);
+                        table.cell_tabled[idx] = ok;
+                    }
+                }
+            }
+        }
+        table
+    }
+
+    fn node_index(&self, pc: usize, iw: usize, plane: usize, iv: usize, ig: usize) -> usize {
+        ((((pc * WEIGHT_NODES + iw) * TERRAIN_PLANES + plane) * GRADE_NODES + ig) * SPEED_NODES) + iv
+    }
+
+    fn cell_index(&self, pc: usize, iw: usize, iv: usize, ig: usize) -> usize {
+        ((pc * WEIGHT_NODES + iw) * (GRADE_NODES - 1) + ig) * (SPEED_NODES - 1) + iv
+    }
+
+    fn exact(&self, pc: usize, iw: usize, terrain: f64, v: f64, g: f64) -> f64 {
+        let w = WEIGHT_MIN_KG + iw as f64 * WEIGHT_STEP_KG;
+        metabolism_power_watts_damped(v, w, g, terrain, pc as i32 + 1, self.dampening)
+    }
+
+    #[allow(clippy::too_many_arguments)]
+    fn bilinear(&self, pc: usize, iw: usize, plane: usize, iv: usize, ig: usize, a: f64, b: f64) -> f64 {
+        let p00 = self.nodes[self.node_index(pc, iw, plane, iv, ig)];
+        let p10 = self.nodes[self.node_index(pc, iw, plane, iv + 1, ig)];
+        let p01 = self.nodes[self.node_index(pc, iw, plane, iv, ig + 1)];
+        let p11 = self.nodes[self.node_index(pc, iw, plane, iv + 1, ig + 1)];
+        let lo = p00 + (p10 - p00) * a;
+        let hi = p01 + (p11 - p01) * a;
+        lo + (hi - lo) * b
+    }
+
+    /// `None` when the query is outside the table domain or lands on a guarded cell.
+    pub fn try_lookup(
+        &self,
+        velocity_ms: f64,
+        total_weight_kg: f64,
+        grade_percent: f64,
+        terrain_factor: f64,
+        movement_phase: i32,
+    ) -> Option<f64> {
+        let pc = phase_class_of(movement_phase)?;
+        if total_weight_kg <= BODY_WEIGHT_KG + 0.5 {
+            return None;
+        }
+        let fv = (velocity_ms - SPEED_MIN_MS) / SPEED_STEP_MS;
+        let fg = (grade_percent - GRADE_MIN_PCT) / GRADE_STEP_PCT;
+        let fw = (total_weight_kg - WEIGHT_MIN_KG) / WEIGHT_STEP_KG;
+        if fv < 0.0
+            || fv > (SPEED_NODES - 1) as f64
+            || fg < 0.0
+            || fg > (GRADE_NODES - 1) as f64
+            || fw < 0.0
+            || fw > (WEIGHT_NODES - 1) as f64
+        {
+            return None;
+        }
+        let iv = (fv.floor() as usize).min(SPEED_NODES - 2);
+        let ig = (fg.floor() as usize).min(GRADE_NODES - 2);
+        let iw = (fw.floor() as usize).min(WEIGHT_NODES - 2);
+        if !self.cell_tabled[self.cell_index(pc, iw, iv, ig)]
+            || !self.cell_tabled[self.cell_index(pc, iw + 1, iv, ig)]
+        {
+            return None;
+        }
+        let a = fv - iv as f64;
+        let b = fg - ig as f64;
+        let c = fw - iw as f64;
+        let t = clip_f64(terrain_factor, TERRAIN_MIN, TERRAIN_MAX);
+        let p1 = (1.0 - c) * self.bilinear(pc, iw, 0, iv, ig, a, b) + c * self.bilinear(pc, iw + 1, 0, iv, ig, a, b);
+        let p2 = (1.0 - c) * self.bilinear(pc, iw, 1, iv, ig, a, b) + c * self.bilinear(pc, iw + 1, 1, iv, ig, a, b);
+        Some((p1 + (p2 - p1) * (t - 1.0)).max(0.0))
+    }
+
+    /// Share of the (phase, weight, grade, speed) cells served from the table.
+    pub fn tabled_fraction(&self) -> f64 {
+        let n = self.cell_tabled.iter().filter(|&&ok| ok).count();
+        n as f64 / self.cell_tabled.len() as f64
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Deterministic LCG so the check is reproducible without extra dependencies.
+    struct Lcg(u64);
+
+    impl Lcg {
+        fn next_f64(&mut self) -> f64 {
+            self.0 = self.0.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+            (self.0 >> 11) as f64 / (1u64 << 53) as f64
+        }
+
+        fn uniform(&mut self, lo: f64, hi: f64) -> f64 {
+            lo + (hi - lo) * self.next_f64()
+        }
+    }
+
+    fn check_bound(dampening: f64, seed: u64) {
+        let table = MetabolismTable::build(dampening);
+        let mut rng = Lcg(seed);
+        let mut served = 0usize;
+        let mut worst = 0.0f64;
+        for _ in 0..200_000 {
+            let v = rng.uniform(SPEED_MIN_MS, 6.0);
+            let w = rng.uniform(90.6, 150.0);
+            let g = rng.uniform(-30.0, 30.0);
+            let t = rng.uniform(TERRAIN_MIN, TERRAIN_MAX);
+            let phase = (rng.next_f64() * 4.0) as i32;
+            if let Some(p) = table.try_lookup(v, w, g, t, phase) {
+                let exact = metabolism_power_watts_damped(v, w, g, t, phase, dampening);
+                let ratio = (p - exact).abs() / tolerance_watts(exact);
+                worst = worst.max(ratio);
+                served += 1;
+            }
+        }
+        assert!(worst <= 1.0, "table error exceeds bound: worst/tol = {worst}");
+        assert!(served > 180_000, "table serves too few queries: {served}");
+    }
+
+    #[test]
+    fn lookup_within_bound_default_dampening() {
+        check_bound(0.70, 0x5eed_0001);
+    }
+
+    #[test]
+    fn lookup_within_bound_no_dampening() {
+        check_bound(1.0, 0x5eed_0002);
+    }
+
+    #[test]
+    fn exact_at_nodes() {
+        let table = MetabolismTable::build(0.70);
+        for &(v, w, g, phase) in &[(1.3, 115.0, 5.0, 1), (3.2, 120.0, -8.0, 2), (5.0, 100.0, 10.0, 3)] {
+            if let Some(p) = table.try_lookup(v, w, g, 1.0, phase) {
+                let exact = metabolism_power_watts_damped(v, w, g, 1.0, phase, 0.70);
+                assert!((p - exact).abs() < 1e-6 * exact.max(1.0), "node mismatch at v={v} w={w} g={g}");
+            }
+        }
+    }
+
+    #[test]
+    fn outside_domain_falls_back() {
+        let table = MetabolismTable::build(0.70);
+        assert!(table.try_lookup(0.05, 120.0, 0.0, 1.0, 1).is_none());
+        assert!(table.try_lookup(2.0, 120.0, 45.0, 1.0, 2).is_none());
+        assert!(table.try_lookup(2.0, 90.2, 0.0, 1.0, 2).is_none());
+        assert!(table.try_lookup(2.0, 160.0, 0.0, 1.0, 2).is_none());
+        assert!(table.try_lookup(2.0, 120.0, 0.0, 1.0, 7).is_none());
+    }
+}
@@ -0,0 +1,306 @@
+//! Tabulated power → speed inversion (mirror of `SCR_RSS_SpeedInverseTable.c`).
+//!
+//! Generator: for a quantised (total weight, grade, terrain, phase) context, sample
+//! `metabolism_power_watts` on 33 speed nodes spaced `V6_INVERT_SPEED_MAX_MS / 32` apart.
+//! The first five midpoints of the 24-step bisection land exactly on these nodes, so a fixed
+//! five-level descent over the table takes the same branch as the bisection even where the
+//! power curve is not monotone (low-speed Pandolf hump, Walk LCDA→Pandolf switch).
+//! Lookup: that descent, linear interpolation in the final cell, then one Newton step against
+//! the exact power using the tabled cell slope (plus one false-position step when that step
+//! leaves the cell). Cells where that is not accurate enough (see
+//! `cell_needs_exact`) finish the remaining bisection levels inside the cell instead.
+//!
+//! Verifier: `speed_inverse_verify` bin and the tests below compare against
+//! `invert_speed_for_power_watts`.
+
+use crate::constants::{LCDA_MAX_SPEED_MS, V6_INVERT_SPEED_MAX_MS};
+use crate::metabolism::metabolism_power_watts_damped;
+
+pub const DESCENT_LEVELS: usize = 5;
+/// Bisection depth over a guarded three-cell bracket; same resolution as the 24-level inversion.
+pub const GUARDED_BISECTION_LEVELS: usize = 21;
+pub const FORWARD_NODES: usize = (1 << DESCENT_LEVELS) + 1;
+pub const FORWARD_SPEED_STEP_MS: f64 = V6_INVERT_SPEED_MAX_MS / (1 << DESCENT_LEVELS) as f64;
+
+pub const WEIGHT_QUANT_KG: f64 = 0.5;
+pub const GRADE_QUANT_PCT: f64 = 0.5;
+pub const TERRAIN_QUANT: f64 = 0.05;
+
+/// Agreement with the bisection where the crossing is unique and continuous (m/s).
+pub const SPEED_TOL_MS: f64 = 0.02;
+
+pub fn quantize(value: f64, step: f64) -> f64 {
+    (value / step).round() * step
+}
+
+/// Cells where one Newton step is not enough: the v < 0.1 static branch (cell 0), the Walk
+/// LCDA→Pandolf switch, and cells whose midpoint deviates from linear by more than 1 %.
+fn cell_needs_exact(cell: usize, movement_phase: i32, p_lo: f64, p_hi: f64, p_mid: f64) -> bool {
+    if cell == 0 {
+        return true;
+    }
+    let v_lo = cell as f64 * FORWARD_SPEED_STEP_MS;
+    if (movement_phase == 0 || movement_phase == 1)
+        && v_lo <= LCDA_MAX_SPEED_MS
+        && LCDA_MAX_SPEED_MS <= v_lo + FORWARD_SPEED_STEP_MS
+    {
+        return true;
+    }
+    let linear = 0.5 * (p_lo + p_hi);
+    (p_mid - linear).abs() > (0.01 * p_mid.abs()).max(2.0)
+}
+
+pub struct SpeedInverseTable {
+    forward: Vec<f64>,
+    cell_exact: Vec<bool>,
+}
+
+impl SpeedInverseTable {
+    /// Build for the quantised context that `(weight, grade, terrain)` falls in.
+    pub fn build(
+        total_weight_kg: f64,
+        grade_percent: f64,
+        terrain_factor: f64,
+        movement_phase: i32,
+        load_metabolic_dampening: f64,
+    ) -> Self {
+        let w = quantize(total_weight_kg, WEIGHT_QUANT_KG);
+        let g = quantize(grade_percent, GRADE_QUANT_PCT);
+        let t = quantize(terrain_factor, TERRAIN_QUANT);
+        let power = |v: f64| metabolism_power_watts_damped(v, w, g, t, movement_phase, load_metabolic_dampening);
+        let forward: Vec<f64> = (0..FORWARD_NODES)
+            .map(|i| power(i as f64 * FORWARD_SPEED_STEP_MS))
+            .collect();
+        let cell_exact = (0..FORWARD_NODES - 1)
+            .map(|i| {
+                let p_mid = power((i as f64 + 0.5) * FORWARD_SPEED_STEP_MS);
+                cell_needs_exact(i, movement_phase, forward[i], forward[i + 1], p_mid)
+            })
+            .collect();
+        SpeedInverseTable { forward, cell_exact }
+    }
+
+    /// Number of cells that fall back to bisection (verifier statistics).
+    pub fn guarded_cells(&self) -> usize {
+        self.cell_exact.iter().filter(|&&exact| exact).count()
+    }
+
+    /// Speed at which power reaches `target_power_watts` for the exact context.
+    pub fn lookup(
+        &self,
+        target_power_watts: f64,
+        total_weight_kg: f64,
+        grade_percent: f64,
+        terrain_factor: f64,
+        movement_phase: i32,
+        load_metabolic_dampening: f64,
+    ) -> f64 {
+        if target_power_watts <= 1.0 {
+            return 0.0;
+        }
+
+        let mut lo = 0usize;
+        let mut hi = FORWARD_NODES - 1;
+        for _ in 0..DESCENT_LEVELS {
+            let mid = (lo + hi) / 2;
+            if self.forward[mid] > target_power_watts {
+                hi = mid;
+            } else {
+                lo = mid;
+            }
+        }
+
+        let v_lo = lo as f64 * FORWARD_SPEED_STEP_MS;
+        let v_hi = hi as f64 * FORWARD_SPEED_STEP_MS;
+        if self.cell_exact[lo] {
+            // Bisect to the same resolution as the exact inversion. The bracket is widened by one
+            // cell on a side because quantisation can move the crossing just past a node, but only
+            // where the neighbouring node keeps the bracket (power ≤ target on the left, > target
+            // on the right); on a non-monotone stretch widening would bracket another crossing.
+            let mut a = v_lo;
+            if lo > 0 && self.forward[lo - 1] <= target_power_watts {
+                a = v_lo - FORWARD_SPEED_STEP_MS;
+            }
+            let mut b = v_hi;
+            if hi < FORWARD_NODES - 1 && self.forward[hi + 1] > target_power_watts {
+                b = v_hi + FORWARD_SPEED_STEP_MS;
+            }
+            for _ in 0..GUARDED_BISECTION_LEVELS {
+                let mid = (a + b) * 0.5;
+                let p = metabolism_power_watts_damped(
+                    mid,
+                    total_weight_kg,
+                    grade_percent,
+                    terrain_factor,
+                    movement_phase,
+                    load_metabolic_dampening,
+                );
+                if p > target_power_watts {
+                    b = mid;
+                } else {
+                    a = mid;
+                }
+            }
+            return (a + b) * 0.5;
+        }
+
+        let p_lo = self.forward[lo];
+        let p_hi = self.forward[hi];
+        let frac = if (p_hi - p_lo).abs() > 1e-6 {
+            ((target_power_watts - p_lo) / (p_hi - p_lo)).clamp(0.0, 1.0)
+        } else {
+            0.5
+        };
+        let v_est = v_lo + (v_hi - v_lo) * frac;
+
+        // One Newton step on the exact curve with the tabled cell slope. The slope is insensitive
+        // to the quantisation offset, so this also recovers crossings that the offset pushed just
+        // past a node.
+        let p = metabolism_power_watts_damped(
+            v_est,
+            total_weight_kg,
+            grade_percent,
+            terrain_factor,
+            movement_phase,
+            load_metabolic_dampening,
+        );
+        let slope = (p_hi - p_lo) / FORWARD_SPEED_STEP_MS;
+        if slope <= 1e-6 {
+            return v_est;
+        }
+        let v = (v_est + (target_power_watts - p) / slope)
+            .clamp(v_lo - FORWARD_SPEED_STEP_MS, v_hi + FORWARD_SPEED_STEP_MS)
+            .clamp(0.0, V6_INVERT_SPEED_MAX_MS);
+        if v >= v_lo && v <= v_hi {
+            return v;
+        }
+
+        // The step left the cell, so the cell slope says little about where it landed (a kink or
+        // a much steeper neighbour). One false-position step between the two exact samples when
+        // they bracket the target.
+        let p_out = metabolism_power_watts_damped(
+            v,
+            total_weight_kg,
+            grade_percent,
+            terrain_factor,
+            movement_phase,
+            load_metabolic_dampening,
+        );
+        if (p - target_power_watts) * (p_out - target_power_watts) < 0.0 {
+            return v_est + (target_power_watts - p) * (v - v_est) / (p_out - p);
+        }
+        v
+    }
+}
+
+/// Crossing classification used by the verifier: a query is "regular" when the exact power
+/// crosses the target exactly once on a dense grid and is continuous within one table cell of
+/// that crossing. Elsewhere (jumps, multiple branches) only branch agreement is expected.
+pub fn is_regular_query(
+    target_power_watts: f64,
+    total_weight_kg: f64,
+    grade_percent: f64,
+    terrain_factor: f64,
+    movement_phase: i32,
+    load_metabolic_dampening: f64,
+) -> bool {
+    const SAMPLES: usize = 1200;
+    let dv = V6_INVERT_SPEED_MAX_MS / SAMPLES as f64;
+    let powers: Vec<f64> = (0..=SAMPLES)
+        .map(|i| {
+            metabolism_power_watts_damped(
+                i as f64 * dv,
+                total_weight_kg,
+                grade_percent,
+                terrain_factor,
+                movement_phase,
+                load_metabolic_dampening,
+            )
+        })
+        .collect();
+
+    let mut crossing = None;
+    for i in 1..=SAMPLES {
+        if (powers[i] > target_power_watts) != (powers[i - 1] > target_power_watts) {
+            if crossing.is_some() {
+                return false;
+            }
+            crossing = Some(i);
+        }
+    }
+    let Some(c) = crossing else {
+        return false;
+    };
+
+    let window = (FORWARD_SPEED_STEP_MS / dv).ceil() as usize;
+    let from = c.saturating_sub(window).max(1);
+    let to = (c + window).min(SAMPLES);
+    (from..=to).all(|i| (powers[i] - powers[i - 1]).abs() <= 0.05 * target_power_watts)
+}
+
+/// Power-space tolerance for regular queries where the curve is flat in speed.
+pub fn power_tolerance_watts(target_power_watts: f64) -> f64 {
+    (0.01 * target_power_watts).max(2.0)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::metabolism::{invert_speed_for_power_watts, metabolism_power_watts};
+
+    struct Lcg(u64);
+
+    impl Lcg {
+        fn next_f64(&mut self) -> f64 {
+            self.0 = self.0.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+            (self.0 >> 11) as f64 / (1u64 << 53) as f64
+        }
+
+        fn uniform(&mut self, lo: f64, hi: f64) -> f64 {
+            lo + (hi - lo) * self.next_f64()
+        }
+    }
+
+    #[test]
+    fn agrees_with_bisection() {
+        let mut rng = Lcg(0x1a7e_0030);
+        let mut queries = 0usize;
+        let mut branch_misses = 0usize;
+        for _ in 0..1500 {
+            let w = rng.uniform(90.0, 150.0);
+            let g = rng.uniform(-30.0, 30.0);
+            let t = rng.uniform(0.8, 2.5);
+            let phase = 1 + (rng.next_f64() * 3.0) as i32;
+            let table = SpeedInverseTable::build(w, g, t, phase, 0.70);
+            for _ in 0..8 {
+                let target = rng.uniform(100.0, 2500.0);
+                let exact = invert_speed_for_power_watts(target, w, g, t, phase);
+                let tabled = table.lookup(target, w, g, t, phase, 0.70);
+                let dv = (exact - tabled).abs();
+                queries += 1;
+                if dv > FORWARD_SPEED_STEP_MS {
+                    branch_misses += 1;
+                }
+                if is_regular_query(target, w, g, t, phase, 0.70) && dv > SPEED_TOL_MS {
+                    let residual = (metabolism_power_watts(tabled, w, g, t, phase) - target).abs();
+                    assert!(
+                        residual <= power_tolerance_watts(target),
+                        "w={w} g={g} t={t} phase={phase} P={target}: bisection {exact} vs table {tabled}"
+                    );
+                }
+            }
+        }
+        // Branch flips only happen when a quantised node sits within rounding of the target.
+        assert!(
+            (branch_misses as f64) < 0.005 * queries as f64,
+            "too many branch disagreements: {branch_misses}/{queries}"
+        );
+    }
+
+    #[test]
+    fn saturates_like_bisection() {
+        let table = SpeedInverseTable::build(120.0, 0.0, 1.0, 2, 0.70);
+        assert_eq!(table.lookup(0.5, 120.0, 0.0, 1.0, 2, 0.70), 0.0);
+        assert_eq!(table.lookup(1.0e6, 120.0, 0.0, 1.0, 2, 0.70), V6_INVERT_SPEED_MAX_MS);
+    }
+}
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+SCR_RSS_AstronomyDayTable 精度对照：逐日基准气温 + 96 点昼夜相位插值 vs SCR_RSS_AstronomyMath 逐次求值，
+以及 EstimateLatLongFromAstronomicalSearch 网格搜索记忆化的键是否覆盖全部搜索输入。
+
+采样数、步长与昼夜温差从游戏脚本读取；气温公式为 SCR_RSS_AstronomyMath 的转写。
+"""
+
+from __future__ import annotations
+
+import math
+import re
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from enforce_source import method_body, read_script, static_const  # noqa: E402
+
+ASTRONOMY_MATH = read_script("RSS/Environment/SCR_RSS_AstronomyMath.c")
+DAY_TABLE = read_script("RSS/Environment/SCR_RSS_AstronomyDayTable.c")
+
+DAILY_TEMP_RANGE = static_const(ASTRONOMY_MATH, "DAILY_TEMP_RANGE")
+SAMPLES_PER_DAY = int(static_const(DAY_TABLE, "SAMPLES_PER_DAY"))
+HOURS_PER_SAMPLE = static_const(DAY_TABLE, "HOURS_PER_SAMPLE")
+
+# 容差：与 CHANGELOG 所述“气温误差 < 0.01 °C”一致
+TOL_TEMP_C = 0.01
+
+
+# —— 参考实现（SCR_RSS_AstronomyMath）——
+def baseline_temperature(lat: float, n: int) -> float:
+    lat_rad = lat * math.pi / 180.0
+    base = 27.0 - 42.0 * math.sin(lat_rad) ** 2
+    season_range = 2.0 + 20.0 * abs(math.sin(lat_rad))
+    year_phase = (float(n) - 15.0) / 365.0 * 2.0 * math.pi
+    hemisphere = -1.0 if lat >= 0.0 else 1.0
+    return base + hemisphere * season_range * math.cos(year_phase)
+
+
+def rain_cooling(current_base: float, rain: float) -> float:
+    if current_base <= 10.0 or rain <= 0.0:
+        return 0.0
+    return min(5.0, rain * 5.0 * ((current_base - 10.0) / 20.0))
+
+
+def universal_temperature(lat, n, hour, alt, overcast, rain, fog) -> float:
+    damping = 1.0 - overcast * 0.5 - fog * 0.3
+    rng = DAILY_TEMP_RANGE * max(0.2, damping)
+    daily = (rng / 2.0) * math.sin((hour - 9.5) / 24.0 * 2.0 * math.pi)
+    current = baseline_temperature(lat, n) + daily - (alt / 1000.0) * 6.5
+    return current - rain_cooling(current, rain)
+
+
+# —— 查表实现（SCR_RSS_AstronomyDayTable）——
+class DayTable:
+    def __init__(self, lat: float, n: int):
+        self.phase_sin = []
+        for i in range(SAMPLES_PER_DAY + 1):
+            hour = i * HOURS_PER_SAMPLE
+            self.phase_sin.append(math.sin((hour - 9.5) / 24.0 * 2.0 * math.pi))
+        self.baseline = baseline_temperature(lat, n)
+
+    @staticmethod
+    def interpolate(table, hour: float) -> float:
+        h = hour % 24.0
+        pos = h / HOURS_PER_SAMPLE
+        i0 = min(int(math.floor(pos)), SAMPLES_PER_DAY - 1)
+        frac = pos - i0
+        return table[i0] + (table[i0 + 1] - table[i0]) * frac
+
+    def temperature(self, hour, alt, overcast, rain, fog) -> float:
+        damping = 1.0 - overcast * 0.5 - fog * 0.3
+        rng = DAILY_TEMP_RANGE * max(0.2, damping)
+        daily = (rng / 2.0) * self.interpolate(self.phase_sin, hour)
+        current = self.baseline + daily - (alt / 1000.0) * 6.5
+        return current - rain_cooling(current, rain)
+
+
+def _hours():
+    # 非对齐采样点（7 分钟步长），覆盖插值最坏位置
+    h = 0.0
+    while h < 24.0:
+        yield h
+        h += 7.0 / 60.0
+
+
+def check_temperature_accuracy() -> bool:
+    lats = [-66.5, -45.0, -23.4, 0.0, 12.3, 37.9, 45.0, 55.7, 70.0]
+    days = [1, 80, 172, 266, 355, 366]
+    weathers = [
+        (0.0, 0.0, 0.0, 0.0),
+        (350.0, 0.7, 0.4, 0.2),
+        (1200.0, 0.95, 1.0, 0.8),
+    ]
+
+    max_temp = 0.0
+    for lat in lats:
+        for n in days:
+            table = DayTable(lat, n)
+            for hour in _hours():
+                for alt, overcast, rain, fog in weathers:
+                    ref = universal_temperature(lat, n, hour, alt, overcast, rain, fog)
+                    tab = table.temperature(hour, alt, overcast, rain, fog)
+                    max_temp = max(max_temp, abs(ref - tab))
+    print(f"    temperature max_abs_err={max_temp:.6f} tol={TOL_TEMP_C}")
+    return max_temp <= TOL_TEMP_C
+
+
+def check_wrap_around() -> bool:
+    # 24:00 回绕与 0:00 一致
+    table = DayTable(37.9, 172)
+    wrap = abs(table.interpolate(table.phase_sin, 24.0) - table.interpolate(table.phase_sin, 0.0))
+    return wrap <= 1e-9
+
+
+def _params(text: str, name: str) -> list[str]:
+    m = re.search(r"\b" + name + r"\s*\(([^)]*)\)", text)
+    return [p.split()[-1] for p in m.group(1).split(",")]
+
+
+def check_search_cache_key() -> bool:
+    """记忆化的键须覆盖网格搜索的全部输入，命中时返回的正是未命中时存下的搜索结果。"""
+    estimate = method_body(ASTRONOMY_MATH, "EstimateLatLongFromAstronomicalSearch")
+    key = _params(estimate, "IsSearchCached")
+    search_args = [a.strip() for a in re.search(r"SearchLatLongGrid\(([^;]*)\);", estimate).group(1).split(",")]
+
+    # 搜索输入：weatherManager 只用日期型纯函数查询，昼长/正午由观测日出日落导出
+    search_body = method_body(ASTRONOMY_MATH, "SearchLatLongGrid")
+    engine_calls = set(re.findall(r"weatherManager\.(\w+)\(", search_body))
+    if engine_calls != {"GetSunriseHourForDate", "GetSunsetHourForDate"}:
+        print(f"    SearchLatLongGrid uses weatherManager.{sorted(engine_calls)}")
+        return False
+    derived = {"obsL": {"obsSR", "obsSS"}, "obsNoon": {"obsSR", "obsSS"}}
+    for name, sources in derived.items():
+        m = re.search(r"float " + name + r" = ([^;]+);", estimate)
+        if not m or set(re.findall(r"[A-Za-z_]\w*", m.group(1))) - {"Math"} != sources:
+            print(f"    {name} is not derived from {sorted(sources)} only")
+            return False
+    inputs = set()
+    for arg in search_args[1:-2]:
+        inputs |= derived.get(arg, {arg})
+    missing = inputs - set(key)
+    if missing or "worldKey" not in key:
+        print(f"    cache key {key} misses {sorted(missing)}")
+        return False
+
+    # 键比较与写入逐字段对应：每个键字段在未命中时写入、命中时按 == 比较
+    cached = method_body(ASTRONOMY_MATH, "IsSearchCached")
+    params = _params(ASTRONOMY_MATH, "protected static bool IsSearchCached")
+    for param in params:
+        stored = re.search(r"(s_\w+) = " + param + r";", estimate)
+        if not stored or not re.search(stored.group(1) + r" == " + param + r"\b", cached):
+            print(f"    key field {param} is not stored and compared")
+            return False
+
+    # 命中路径读回的就是未命中路径存下的结果；月相项在缓存外叠加
+    for out_name in ("bestErr", "bestLat", "bestLon"):
+        stored = re.search(r"(s_\w+) = " + out_name + r";", estimate)
+        if not stored or not re.search(out_name + r" = " + stored.group(1) + r";", estimate):
+            print(f"    {out_name} is not restored from the cache")
+            return False
+    return estimate.index("bestErr += wMoon") > estimate.index("s_fSearchLon = bestLon;")
+
+
+SCENARIOS = [
+    ("逐日表气温误差", check_temperature_accuracy),
+    ("24:00 回绕", check_wrap_around),
+    ("经纬度搜索记忆化键覆盖全部输入", check_search_cache_key),
+]
+
+
+def main() -> int:
+    failed = 0
+    for name, fn in SCENARIOS:
+        try:
+            ok = fn()
+        except (AttributeError, KeyError, ValueError) as exc:
+            print(f"  [FAIL] {name}: {exc}")
+            failed += 1
+            continue
+        if ok:
+            print(f"  [PASS] {name}")
+        else:
+            print(f"  [FAIL] {name}")
+            failed += 1
+    if failed:
+        print(f"test_astronomy_day_table: {failed} failure(s)")
+        return 1
+    print(f"test_astronomy_day_table: {len(SCENARIOS)}/{len(SCENARIOS)} passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
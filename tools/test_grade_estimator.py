@@ -0,0 +1,443 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+高度图预测坡度（SCR_RSS_GradeEstimator）离线精度对照：沿路径回放，比较
+
+- 法线路径：2 m 格心法线 × 速度投影 → RSS_SmoothGradePercentForSpeed（EMA tau 0.55 + 55 %/s 限速）；
+- 估计器：缓存高度格双线性插值，中心差分平滑坡度 + 前瞻最小二乘预测，限速取二者混合。
+
+移动中 SampleSlope 只走估计器（代谢用其原始中心差分坡度），不再查法线；因此查询开销对照的是
+“估计器高度格未命中” vs “原法线格未命中”，而不是二者之和。
+
+真值：当前坡度 = 路径上 ±0.5 m 的高度差分；前方坡度 = 未来 HORIZON_SEC 内路径的平均坡度。
+断言：估计器限速坡度对前方坡度的 RMSE 低于法线路径，平滑坡度与原始坡度（代谢）对当前坡度的误差
+不劣于法线路径；每 tick 高度格未命中不多于原法线路径的 (1 + MAX_QUERY_OVERHEAD) 倍。
+
+默认回放内置的合成地形与路径（固定种子）；录制数据用
+    python test_grade_estimator.py --path run.csv [--heightmap grid.csv]
+path CSV 列为 t,x,z（秒、米）；heightmap CSV 首行 "cell_size,x0,z0"，其后每行一排 z 相同的高度。
+两条路径的常量从 SCR_RSS_GradeEstimator.c、SCR_RSS_TerrainNormalCache.c 与
+PlayerBase.RSS_SmoothGradePercentForSpeed 读取；估计器的平滑、限速与前瞻写法直接对照脚本，
+脚本改动而此处未跟上时失败。
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+import math
+import random
+import re
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from enforce_source import calls, method_body, read_script, static_const  # noqa: E402
+
+GRADE_ESTIMATOR = read_script("RSS/Core/SCR_RSS_GradeEstimator.c")
+PLAYER_BASE = read_script("Integration/PlayerBase.c")
+
+
+def local_float(body: str, name: str) -> float:
+    """方法体内 `float NAME = <数字>;` 的取值。"""
+    m = re.search(r"\bfloat\s+" + re.escape(name) + r"\s*=\s*([\d.]+);", body)
+    if not m:
+        raise KeyError(f"local {name} not found")
+    return float(m.group(1))
+
+
+# —— SCR_RSS_GradeEstimator 常量 ——
+CELL_SIZE_M = static_const(GRADE_ESTIMATOR, "CELL_SIZE_M")
+BASE_HALF_M = static_const(GRADE_ESTIMATOR, "BASE_HALF_M")
+LOOKAHEAD_POINTS = int(static_const(GRADE_ESTIMATOR, "LOOKAHEAD_POINTS"))
+HORIZON_SEC = static_const(GRADE_ESTIMATOR, "HORIZON_SEC")
+MIN_STEP_M = static_const(GRADE_ESTIMATOR, "MIN_STEP_M")
+MAX_STEP_M = static_const(GRADE_ESTIMATOR, "MAX_STEP_M")
+SMOOTH_TAU_SEC = static_const(GRADE_ESTIMATOR, "SMOOTH_TAU_SEC")
+MAX_DELTA_PCT_PER_SEC = static_const(GRADE_ESTIMATOR, "MAX_DELTA_PCT_PER_SEC")
+ANTICIPATION = static_const(GRADE_ESTIMATOR, "ANTICIPATION")
+HEADING_SPEED_MIN_MS = static_const(GRADE_ESTIMATOR, "HEADING_SPEED_MIN_MS")
+TELEPORT_RESET_M = static_const(GRADE_ESTIMATOR, "TELEPORT_RESET_M")
+
+# —— 法线路径（SCR_RSS_TerrainNormalCache + RSS_SmoothGradePercentForSpeed）——
+_SMOOTH_FOR_SPEED = method_body(PLAYER_BASE, "RSS_SmoothGradePercentForSpeed")
+NORMAL_CELL_SIZE_M = static_const(read_script("RSS/Core/SCR_RSS_TerrainNormalCache.c"), "CELL_SIZE_M")
+NORMAL_TAU_SEC = local_float(_SMOOTH_FOR_SPEED, "tau")
+NORMAL_MAX_DELTA_PCT_PER_SEC = local_float(_SMOOTH_FOR_SPEED, "maxDeltaPerSec")
+GRADE_ABS_MAX_PCT = static_const(read_script("RSS/Core/SCR_RSS_Constants.c"), "V6_METABOLIC_GRADE_ABS_MAX_PCT")
+
+# GradeEstimator.estimate / replay 中限速坡度所依据的脚本写法（空白归一后逐字匹配）
+ESTIMATOR_STATEMENTS = (
+    ("Estimate", "vector.DistanceSq(pos, m_vLastPos) > TELEPORT_RESET_M * TELEPORT_RESET_M"),
+    ("Estimate", "float dt = Math.Clamp(currentTimeSec - m_fLastTimeSec, 0.01, 0.5);"),
+    ("Estimate", "float maxStep = MAX_DELTA_PCT_PER_SEC * dt;"),
+    ("Estimate", "float alpha = dt / (SMOOTH_TAU_SEC + dt);"),
+    ("SampleCurrentGrade", "float ratio = (hFront - hBack) / (2.0 * BASE_HALF_M);"),
+    ("SampleForecastGrade", "float step = Math.Clamp(speed * HORIZON_SEC / LOOKAHEAD_POINTS, MIN_STEP_M, MAX_STEP_M);"),
+    ("SampleForecastGrade", "if (denom < 0.0001) return 0.0;"),
+    ("BlendForSpeedCap", "return est.m_fGradePercent + ANTICIPATION * (est.m_fForecastGradePercent - est.m_fGradePercent);"),
+)
+
+TICK_SEC = 0.05
+# 估计器限速坡度 RMSE 须至少比法线路径低此比例；平滑坡度允许的相对劣化
+MIN_FORECAST_GAIN = 0.10
+MAX_CURRENT_REGRESSION = 0.05
+MAX_QUERIES_PER_TICK = 0.5
+MAX_QUERY_OVERHEAD = 0.15
+
+
+def clamp(v: float, lo: float, hi: float) -> float:
+    return lo if v < lo else hi if v > hi else v
+
+
+class Terrain:
+    """地形高度 h(x, z)；query() 计一次“引擎地形查询”。"""
+
+    def __init__(self, height_fn):
+        self.height_fn = height_fn
+        self.queries = 0
+
+    def query(self, x: float, z: float) -> float:
+        self.queries += 1
+        return self.height_fn(x, z)
+
+    def normal(self, x: float, z: float) -> tuple[float, float, float]:
+        e = 0.25
+        dhdx = (self.height_fn(x + e, z) - self.height_fn(x - e, z)) / (2 * e)
+        dhdz = (self.height_fn(x, z + e) - self.height_fn(x, z - e)) / (2 * e)
+        n = (-dhdx, 1.0, -dhdz)
+        length = math.sqrt(n[0] ** 2 + n[1] ** 2 + n[2] ** 2)
+        return (n[0] / length, n[1] / length, n[2] / length)
+
+
+def synthetic_terrain(seed: int) -> Terrain:
+    rng = random.Random(seed)
+    hills = [
+        (rng.uniform(-300, 300), rng.uniform(-300, 300), rng.uniform(8, 30), rng.uniform(25, 70))
+        for _ in range(14)
+    ]
+    waves = [(rng.uniform(0.01, 0.05), rng.uniform(0.01, 0.05), rng.uniform(0.5, 2.0)) for _ in range(3)]
+
+    def height(x: float, z: float) -> float:
+        h = 0.0
+        for cx, cz, amp, sigma in hills:
+            h += amp * math.exp(-((x - cx) ** 2 + (z - cz) ** 2) / (2 * sigma * sigma))
+        for kx, kz, amp in waves:
+            h += amp * math.sin(kx * x) * math.cos(kz * z)
+        return h
+
+    return Terrain(height)
+
+
+def grid_terrain(path: Path) -> Terrain:
+    with path.open(encoding="utf-8") as f:
+        rows = list(csv.reader(f))
+    cell, x0, z0 = (float(v) for v in rows[0][:3])
+    grid = [[float(v) for v in row] for row in rows[1:] if row]
+
+    def height(x: float, z: float) -> float:
+        gx = clamp((x - x0) / cell, 0.0, len(grid[0]) - 1.001)
+        gz = clamp((z - z0) / cell, 0.0, len(grid) - 1.001)
+        ix, iz = int(gx), int(gz)
+        fx, fz = gx - ix, gz - iz
+        h0 = grid[iz][ix] + (grid[iz][ix + 1] - grid[iz][ix]) * fx
+        h1 = grid[iz + 1][ix] + (grid[iz + 1][ix + 1] - grid[iz + 1][ix]) * fx
+        return h0 + (h1 - h0) * fz
+
+    return Terrain(height)
+
+
+def synthetic_paths(seed: int) -> list[tuple[str, list[tuple[float, float, float]]]]:
+    """(名称, [(t, x, z)])：直线越岭、之字形、随机游走，含走/跑/冲刺速度段。"""
+    rng = random.Random(seed)
+    out = []
+
+    def integrate(name, speed_fn, heading_fn, duration, x=0.0, z=0.0):
+        pts = []
+        t = 0.0
+        while t <= duration:
+            pts.append((t, x, z))
+            v = speed_fn(t)
+            a = heading_fn(t)
+            x += math.cos(a) * v * TICK_SEC
+            z += math.sin(a) * v * TICK_SEC
+            t += TICK_SEC
+        out.append((name, pts))
+
+    integrate("straight_run", lambda t: 3.2, lambda t: 0.35, 120.0, -200.0, -150.0)
+    integrate("switchback_walk", lambda t: 1.5, lambda t: 0.6 + 1.2 * math.copysign(1, math.sin(t / 12.0)), 180.0)
+    turns = [rng.uniform(-0.6, 0.6) for _ in range(40)]
+    speeds = [rng.choice((1.4, 2.8, 4.8)) for _ in range(40)]
+    integrate(
+        "random_mixed",
+        lambda t: speeds[int(t / 6.0) % 40],
+        lambda t: sum(turns[: int(t / 6.0) % 40 + 1]),
+        200.0,
+        50.0,
+        -80.0,
+    )
+    return out
+
+
+def load_path(path: Path) -> list[tuple[float, float, float]]:
+    with path.open(encoding="utf-8") as f:
+        return [(float(r["t"]), float(r["x"]), float(r["z"])) for r in csv.DictReader(f)]
+
+
+class HeightCache:
+    def __init__(self, terrain: Terrain):
+        self.terrain = terrain
+        self.nodes: dict[tuple[int, int], float] = {}
+
+    def node(self, ix: int, iz: int) -> float:
+        key = (ix, iz)
+        h = self.nodes.get(key)
+        if h is None:
+            h = self.terrain.query(ix * CELL_SIZE_M, iz * CELL_SIZE_M)
+            self.nodes[key] = h
+        return h
+
+    def height(self, x: float, z: float) -> float:
+        gx, gz = x / CELL_SIZE_M, z / CELL_SIZE_M
+        ix, iz = math.floor(gx), math.floor(gz)
+        fx, fz = gx - ix, gz - iz
+        h00, h10 = self.node(ix, iz), self.node(ix + 1, iz)
+        h01, h11 = self.node(ix, iz + 1), self.node(ix + 1, iz + 1)
+        h0 = h00 + (h10 - h00) * fx
+        h1 = h01 + (h11 - h01) * fx
+        return h0 + (h1 - h0) * fz
+
+
+class GradeEstimator:
+    def __init__(self, cache: HeightCache):
+        self.cache = cache
+        self.initialized = False
+        self.last_t = -1.0
+        self.smoothed = 0.0
+        self.last_pos = (0.0, 0.0)
+
+    def estimate(self, x, z, vx, vz, t):
+        if self.initialized and math.hypot(x - self.last_pos[0], z - self.last_pos[1]) > TELEPORT_RESET_M:
+            self.initialized = False
+        self.last_pos = (x, z)
+        speed = math.hypot(vx, vz)
+        raw = forecast = 0.0
+        if speed >= HEADING_SPEED_MIN_MS:
+            hx, hz = vx / speed, vz / speed
+            hb = self.cache.height(x - hx * BASE_HALF_M, z - hz * BASE_HALF_M)
+            hf = self.cache.height(x + hx * BASE_HALF_M, z + hz * BASE_HALF_M)
+            raw = clamp((hf - hb) / (2 * BASE_HALF_M), -1.0, 1.0) * 100.0
+
+            step = clamp(speed * HORIZON_SEC / LOOKAHEAD_POINTS, MIN_STEP_M, MAX_STEP_M)
+            sd = sh = sdd = sdh = 0.0
+            for k in range(LOOKAHEAD_POINTS + 1):
+                d = k * step
+                h = self.cache.height(x + hx * d, z + hz * d)
+                sd += d
+                sh += h
+                sdd += d * d
+                sdh += d * h
+            n = LOOKAHEAD_POINTS + 1
+            denom = n * sdd - sd * sd
+            if denom >= 0.0001:
+                forecast = clamp((n * sdh - sd * sh) / denom, -1.0, 1.0) * 100.0
+
+        if not self.initialized:
+            self.initialized = True
+            self.last_t = t
+            self.smoothed = raw
+            return raw, self.smoothed, forecast
+
+        dt = clamp(t - self.last_t, 0.01, 0.5)
+        self.last_t = t
+        max_step = MAX_DELTA_PCT_PER_SEC * dt
+        target = clamp(raw, self.smoothed - max_step, self.smoothed + max_step)
+        self.smoothed += (target - self.smoothed) * dt / (SMOOTH_TAU_SEC + dt)
+        return raw, self.smoothed, forecast
+
+
+class NormalPath:
+    """格心法线缓存 + 速度投影 + RSS_SmoothGradePercentForSpeed。"""
+
+    def __init__(self, terrain: Terrain):
+        self.terrain = terrain
+        self.cells: dict[tuple[int, int], tuple[float, float, float]] = {}
+        self.initialized = False
+        self.last_t = -1.0
+        self.smoothed = 0.0
+
+    def raw_grade(self, x, z, vx, vz) -> float:
+        key = (math.floor(x / NORMAL_CELL_SIZE_M), math.floor(z / NORMAL_CELL_SIZE_M))
+        n = self.cells.get(key)
+        if n is None:
+            self.terrain.queries += 1
+            n = self.terrain.normal((key[0] + 0.5) * NORMAL_CELL_SIZE_M, (key[1] + 0.5) * NORMAL_CELL_SIZE_M)
+            self.cells[key] = n
+        speed = math.hypot(vx, vz)
+        mag = min(math.degrees(math.acos(clamp(n[1], 0.0, 1.0))), 45.0)
+        hl = math.hypot(n[0], n[2])
+        if speed < HEADING_SPEED_MIN_MS or hl < 0.001 or mag < 0.01:
+            return 0.0
+        cos_a = clamp((vx * -n[0] + vz * -n[2]) / (hl * speed), -1.0, 1.0)
+        return clamp(math.tan(math.radians(mag * cos_a)), -1.0, 1.0) * 100.0
+
+    def smooth(self, raw: float, t: float) -> float:
+        raw = clamp(raw, -GRADE_ABS_MAX_PCT, GRADE_ABS_MAX_PCT)
+        if not self.initialized:
+            self.initialized = True
+            self.last_t = t
+            self.smoothed = raw
+            return raw
+        dt = clamp(t - self.last_t, 0.01, 0.5)
+        self.last_t = t
+        max_step = NORMAL_MAX_DELTA_PCT_PER_SEC * dt
+        raw = clamp(raw, self.smoothed - max_step, self.smoothed + max_step)
+        self.smoothed += (raw - self.smoothed) * dt / (NORMAL_TAU_SEC + dt)
+        return self.smoothed
+
+
+def replay(terrain: Terrain, pts: list[tuple[float, float, float]]) -> dict[str, float]:
+    terrain.queries = 0
+    est = GradeEstimator(HeightCache(terrain))
+    normal_terrain = Terrain(terrain.height_fn)
+    normal = NormalPath(normal_terrain)
+    h = terrain.height_fn
+
+    # 前方真值需要路径累计距离
+    cum = [0.0]
+    for i in range(1, len(pts)):
+        cum.append(cum[-1] + math.hypot(pts[i][1] - pts[i - 1][1], pts[i][2] - pts[i - 1][2]))
+
+    err = {"normal_raw": 0.0, "est_raw": 0.0, "normal_cur": 0.0, "est_cur": 0.0, "normal_fwd": 0.0, "est_fwd": 0.0}
+    n = 0
+    j = 0
+    for i in range(1, len(pts) - 1):
+        t, x, z = pts[i]
+        dt = pts[i][0] - pts[i - 1][0]
+        if dt <= 0.0:
+            continue
+        vx = (x - pts[i - 1][1]) / dt
+        vz = (z - pts[i - 1][2]) / dt
+
+        j = max(j, i)
+        while j < len(pts) - 1 and pts[j][0] < t + HORIZON_SEC:
+            j += 1
+        if pts[j][0] < t + HORIZON_SEC - 1e-6:
+            break
+
+        est_raw, smoothed, forecast = est.estimate(x, z, vx, vz, t)
+        cap = clamp(smoothed + ANTICIPATION * (forecast - smoothed), -GRADE_ABS_MAX_PCT, GRADE_ABS_MAX_PCT)
+        normal_raw = normal.raw_grade(x, z, vx, vz)
+        normal_sm = normal.smooth(normal_raw, t)
+
+        speed = math.hypot(vx, vz)
+        if speed < HEADING_SPEED_MIN_MS:
+            continue
+        hx, hz = vx / speed, vz / speed
+        true_cur = clamp((h(x + hx * 0.5, z + hz * 0.5) - h(x - hx * 0.5, z - hz * 0.5)) / 1.0, -1.0, 1.0) * 100.0
+        dist = cum[j] - cum[i]
+        if dist < 0.5:
+            continue
+        true_fwd = clamp((h(pts[j][1], pts[j][2]) - h(x, z)) / dist, -1.0, 1.0) * 100.0
+        true_cur = clamp(true_cur, -GRADE_ABS_MAX_PCT, GRADE_ABS_MAX_PCT)
+        true_fwd = clamp(true_fwd, -GRADE_ABS_MAX_PCT, GRADE_ABS_MAX_PCT)
+
+        err["normal_raw"] += (clamp(normal_raw, -GRADE_ABS_MAX_PCT, GRADE_ABS_MAX_PCT) - true_cur) ** 2
+        err["est_raw"] += (clamp(est_raw, -GRADE_ABS_MAX_PCT, GRADE_ABS_MAX_PCT) - true_cur) ** 2
+        err["normal_cur"] += (normal_sm - true_cur) ** 2
+        err["est_cur"] += (smoothed - true_cur) ** 2
+        err["normal_fwd"] += (normal_sm - true_fwd) ** 2
+        err["est_fwd"] += (cap - true_fwd) ** 2
+        n += 1
+
+    out = {k: math.sqrt(v / max(n, 1)) for k, v in err.items()}
+    ticks = max(len(pts) - 2, 1)
+    out["est_queries_per_tick"] = terrain.queries / ticks
+    out["normal_queries_per_tick"] = normal_terrain.queries / ticks
+    out["samples"] = n
+    return out
+
+
+def check_estimator_matches_script() -> bool:
+    ok = True
+    for method, statement in ESTIMATOR_STATEMENTS:
+        body = re.sub(r"\s+", " ", method_body(GRADE_ESTIMATOR, method))
+        if statement not in body:
+            print(f"    {method}: missing `{statement}`")
+            ok = False
+    return ok
+
+
+def check_speed_cap_clamps_blend() -> bool:
+    # replay 对限速坡度按 ±GRADE_ABS_MAX_PCT 钳位，与 PlayerBase 调用处一致
+    return calls(PLAYER_BASE, "SCR_RSS_SpeedBridge.ClampGradePercentForMetabolicSpeed") and re.search(
+        r"ClampGradePercentForMetabolicSpeed\(SCR_RSS_GradeEstimator\.BlendForSpeedCap\(", PLAYER_BASE
+    ) is not None
+
+
+def check_run(terrain: Terrain, pts: list[tuple[float, float, float]]) -> bool:
+    r = replay(terrain, pts)
+    print(
+        f"    raw {r['normal_raw']:.2f}/{r['est_raw']:.2f}  cur {r['normal_cur']:.2f}/{r['est_cur']:.2f}"
+        f"  fwd {r['normal_fwd']:.2f}/{r['est_fwd']:.2f}  q/tick {r['normal_queries_per_tick']:.3f}/"
+        f"{r['est_queries_per_tick']:.3f}  (normal/est RMSE %)"
+    )
+    errors = []
+    if r["samples"] == 0:
+        errors.append("无有效样本")
+    if r["est_fwd"] > r["normal_fwd"] * (1.0 - MIN_FORECAST_GAIN):
+        errors.append("限速坡度对前方坡度的误差未明显低于法线路径")
+    if r["est_cur"] > r["normal_cur"] * (1.0 + MAX_CURRENT_REGRESSION):
+        errors.append("平滑坡度对当前坡度的误差劣于法线路径")
+    if r["est_raw"] > r["normal_raw"] * (1.0 + MAX_CURRENT_REGRESSION):
+        errors.append("原始坡度（代谢）对当前坡度的误差劣于法线路径")
+    if r["est_queries_per_tick"] > MAX_QUERIES_PER_TICK:
+        errors.append("高度格缓存命中率过低")
+    if r["est_queries_per_tick"] > r["normal_queries_per_tick"] * (1.0 + MAX_QUERY_OVERHEAD):
+        errors.append("移动中地形查询多于原法线路径")
+    for err in errors:
+        print(f"    {err}")
+    return not errors
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    ap.add_argument("--path", type=Path, action="append", help="录制路径 CSV（t,x,z），可多次")
+    ap.add_argument("--heightmap", type=Path, help="高度格 CSV；缺省用内置合成地形")
+    ap.add_argument("--seed", type=int, default=7)
+    args = ap.parse_args()
+
+    terrain = grid_terrain(args.heightmap) if args.heightmap else synthetic_terrain(args.seed)
+    if args.path:
+        runs = [(p.stem, load_path(p)) for p in args.path]
+    else:
+        runs = synthetic_paths(args.seed)
+
+    scenarios = [
+        ("估计器平滑/限速/前瞻与脚本一致", check_estimator_matches_script),
+        ("限速坡度经代谢坡度钳位", check_speed_cap_clamps_blend),
+    ] + [(f"回放 {name}", lambda pts=pts: check_run(terrain, pts)) for name, pts in runs]
+
+    failed = 0
+    for name, fn in scenarios:
+        try:
+            ok = fn()
+        except (KeyError, ValueError) as exc:
+            print(f"  [FAIL] {name}: {exc}")
+            failed += 1
+            continue
+        if ok:
+            print(f"  [PASS] {name}")
+        else:
+            print(f"  [FAIL] {name}")
+            failed += 1
+    if failed:
+        print(f"test_grade_estimator: {failed} failure(s)")
+        return 1
+    print(f"test_grade_estimator: {len(scenarios)}/{len(scenarios)} passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+泥泞滑倒：指数等待时间（SCR_RSS_MudSlipRunner.AccumulateSlipExposure）vs 逐帧掷骰（旧 TryRollMudSlip）。
+
+- ComputeSlipHazardPerSec 对低体力抖动 U 的解析期望与蒙特卡洛一致；
+- 两种判定在恒定工况下的平均滑倒时间一致（旧路径每帧 2 个随机数，新路径每次滑倒 1 个）。
+
+ε_dice、抖动系数、单步暴露上限从脚本读取；解析期望与暴露累积的写法直接对照脚本，
+脚本改动而此处未跟上时失败。
+"""
+
+from __future__ import annotations
+
+import math
+import random
+import re
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from enforce_source import method_body, read_script, static_const  # noqa: E402
+
+ENV_CONSTANTS = read_script("RSS/Environment/SCR_RSS_EnvConstants.c")
+MUD_SLIP_EFFECTS = read_script("RSS/MudSlip/SCR_RSS_MudSlipEffects.c")
+MUD_SLIP_RUNNER = read_script("RSS/MudSlip/SCR_RSS_MudSlipRunner.c")
+
+EPS_DICE = static_const(ENV_CONSTANTS, "ENV_SLIP_GAP_EPSILON_DICE")
+JITTER = static_const(ENV_CONSTANTS, "ENV_SLIP_RCOF_BALANCE_JITTER")
+MAX_STEP_HAZARD = static_const(MUD_SLIP_EFFECTS, "MAX_STEP_HAZARD")
+# 旧逐帧掷骰的单步概率上限
+MAX_STEP_P = 0.6
+
+
+def _deficit_threshold() -> float:
+    body = method_body(MUD_SLIP_EFFECTS, "ComputeSlipHazardPerSec")
+    m = re.search(r"if \(staminaDeficit > ([\d.]+)\)\s*jitter = ", body)
+    if not m:
+        raise KeyError("staminaDeficit jitter gate not found")
+    return float(m.group(1))
+
+
+DEFICIT_MIN = _deficit_threshold()
+
+# 解析期望相对误差；平均滑倒时间相对误差（每组 4000 次事件，σ≈1.6%）
+TOL_EXPECTATION = 0.01
+TOL_MEAN_TIME = 0.06
+
+
+def lambda_rolled(gap0, k, deficit, rng):
+    gap = gap0
+    if deficit > DEFICIT_MIN:
+        gap += rng.random() * JITTER * deficit
+    return k * gap if gap > EPS_DICE else 0.0
+
+
+def hazard_expected(gap0, k, deficit):
+    jitter = JITTER * deficit if deficit > DEFICIT_MIN else 0.0
+    if jitter <= 0.0:
+        return k * gap0 if gap0 > EPS_DICE else 0.0
+    u0 = min(max((EPS_DICE - gap0) / jitter, 0.0), 1.0)
+    return k * ((1.0 - u0) * gap0 + 0.5 * jitter * (1.0 - u0 * u0))
+
+
+def mean_time_rolled(gap0, k, deficit, dt, events, rng):
+    total = 0.0
+    for _ in range(events):
+        t = 0.0
+        while True:
+            t += dt
+            lam = lambda_rolled(gap0, k, deficit, rng)
+            p = min(1.0 - math.exp(-lam * dt), MAX_STEP_P)
+            if rng.random() < p:
+                break
+        total += t
+    return total / events
+
+
+def mean_time_exposure(gap0, k, deficit, dt, events, rng):
+    h = min(hazard_expected(gap0, k, deficit) * dt, MAX_STEP_HAZARD)
+    total = 0.0
+    draws = 0
+    for _ in range(events):
+        u = max(rng.random(), 1e-6)
+        draws += 1
+        survival = 1.0
+        t = 0.0
+        while True:
+            t += dt
+            survival *= math.exp(-h)
+            if survival <= u:
+                break
+        total += t
+    return total / events, draws
+
+
+K = 2.2 * 1.5 * 1.18
+RNG = random.Random(20331)
+
+
+def check_hazard_formula_matches_script() -> bool:
+    # hazard_expected 的闭式与脚本逐字一致
+    body = re.sub(r"\s+", " ", method_body(MUD_SLIP_EFFECTS, "ComputeSlipHazardPerSec"))
+    return (
+        "float u0 = Math.Clamp((eps - gap) / jitter, 0.0, 1.0);" in body
+        and "return lambdaPerGap * ((1.0 - u0) * gap + 0.5 * jitter * (1.0 - u0 * u0));" in body
+        and "if (gap <= eps) return 0.0; return lambdaPerGap * gap;" in body
+    )
+
+
+def check_exposure_matches_script() -> bool:
+    # mean_time_exposure：单步暴露截断、U 下限、生存率 ≤ U 时滑倒
+    body = re.sub(r"\s+", " ", method_body(MUD_SLIP_RUNNER, "AccumulateSlipExposure"))
+    e = static_const(MUD_SLIP_EFFECTS, "M_EULER")
+    return (
+        abs(MAX_STEP_HAZARD + math.log(1.0 - MAX_STEP_P)) <= 1e-6
+        and abs(e - math.e) <= 1e-12
+        and "exposure = SCR_RSS_MudSlipEffects.MAX_STEP_HAZARD;" in body
+        and "Math.Max(Math.RandomFloat01(), 0.000001)" in body
+        and "if (m_fSlipSurvival > m_fSlipThresholdU) return false;" in body
+    )
+
+
+def _check_expectation(gap0, deficit) -> bool:
+    exact = hazard_expected(gap0, K, deficit)
+    n = 400_000
+    mc = sum(lambda_rolled(gap0, K, deficit, RNG) for _ in range(n)) / n
+    err = abs(mc - exact) / max(exact, 1e-9) if exact > 0.0 else mc
+    print(f"    analytic {exact:.5f} vs MC {mc:.5f}")
+    return err <= TOL_EXPECTATION
+
+
+def _check_mean_time(gap0, deficit) -> bool:
+    dt = 0.05
+    events = 4000
+    t_roll = mean_time_rolled(gap0, K, deficit, dt, events, RNG)
+    t_exp, draws = mean_time_exposure(gap0, K, deficit, dt, events, RNG)
+    err = abs(t_roll - t_exp) / t_roll
+    rolls = t_roll / dt * events * (2 if deficit > DEFICIT_MIN else 1)
+    print(f"    rolled {t_roll:.2f}s vs exposure {t_exp:.2f}s (random draws {rolls:.0f} -> {draws})")
+    return err <= TOL_MEAN_TIME
+
+
+SCENARIOS = [
+    ("E[λ] 闭式与脚本 ComputeSlipHazardPerSec 一致", check_hazard_formula_matches_script),
+    ("暴露累积与脚本 AccumulateSlipExposure 一致", check_exposure_matches_script),
+] + [
+    (f"E[λ] 解析 vs 蒙特卡洛 gap0={g:+.3f} deficit={d:.1f}", lambda g=g, d=d: _check_expectation(g, d))
+    for g, d in [(0.0, 0.8), (-0.02, 1.0), (0.005, 0.5), (0.03, 0.0), (0.05, 0.6)]
+] + [
+    (f"平均滑倒时间 掷骰 vs 暴露 gap0={g:+.3f} deficit={d:.1f}", lambda g=g, d=d: _check_mean_time(g, d))
+    for g, d in [(0.005, 0.8), (0.03, 0.0), (0.06, 0.4)]
+]
+
+
+def main() -> int:
+    failed = 0
+    for name, fn in SCENARIOS:
+        try:
+            ok = fn()
+        except (KeyError, ValueError) as exc:
+            print(f"  [FAIL] {name}: {exc}")
+            failed += 1
+            continue
+        if ok:
+            print(f"  [PASS] {name}")
+        else:
+            print(f"  [FAIL] {name}")
+            failed += 1
+    if failed:
+        print(f"test_mud_slip_hazard: {failed} failure(s)")
+        return 1
+    print(f"test_mud_slip_hazard: {len(SCENARIOS)}/{len(SCENARIOS)} passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
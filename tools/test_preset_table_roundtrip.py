@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+SCR_RSS_PresetTable 往返校验：JSON → 表 → JSON 逐位无损，且表布局与网络同步布局一致。
+
+1. PARAM_FIELDS 与 SCR_RSS_SettingsSync.WriteParamsToArray / ApplyParamsFromArray 的字段顺序逐项一致，
+   列数 = SCR_RSS_Settings.PARAMS_ARRAY_SIZE = 表内 PARAM_COUNT。
+2. 每份预设 JSON 合并进表、渲染、再解析回来，导出的每个 JSON 键与原值逐位相等。
+3. 仓库内的表与当前 JSON 同步（重新生成不产生 diff）。
+仅依赖标准库。
+"""
+
+from __future__ import annotations
+
+import re
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from embed_json_to_c import (  # noqa: E402
+    JSON_SLUG_BY_PRESET,
+    PARAM_FIELDS,
+    PRESET_ROWS,
+    embed,
+    format_c_float,
+    load_preset_json,
+    merge_json_into_row,
+    parse_table,
+    render_table,
+    resolve_preset_json,
+    row_to_json,
+)
+
+ROOT = Path(__file__).resolve().parent.parent
+NETWORK_CONFIG = ROOT / "scripts" / "Game" / "RSS" / "NetworkConfig"
+
+
+def check_layout(table_text: str) -> list[str]:
+    errors: list[str] = []
+    sync = (NETWORK_CONFIG / "SCR_RSS_SettingsSync.c").read_text(encoding="utf-8")
+    write_order = tuple(re.findall(r"outArr\.Insert\(p\.(\w+)\);", sync))
+    apply_order = tuple(re.findall(r"p\.(\w+) = values\[i\+\+\];", sync))
+    if write_order != PARAM_FIELDS:
+        errors.append("PARAM_FIELDS 与 WriteParamsToArray 顺序不一致")
+    if apply_order != PARAM_FIELDS:
+        errors.append("PARAM_FIELDS 与 ApplyParamsFromArray 顺序不一致")
+
+    settings = (NETWORK_CONFIG / "SCR_RSS_Settings.c").read_text(encoding="utf-8")
+    m = re.search(r"PARAMS_ARRAY_SIZE = (\d+);", settings)
+    if not m or int(m.group(1)) != len(PARAM_FIELDS):
+        errors.append("PARAMS_ARRAY_SIZE 与 PARAM_FIELDS 列数不一致")
+    m = re.search(r"PARAM_COUNT = (\d+);", table_text)
+    if not m or int(m.group(1)) != len(PARAM_FIELDS):
+        errors.append("表内 PARAM_COUNT 与 PARAM_FIELDS 列数不一致")
+    return errors
+
+
+def check_literals() -> list[str]:
+    errors: list[str] = []
+    samples = [0.0, 1.0, 0.7, 5e-05, 1.7007074390325853e-07, 2.2897951197083501e+04,
+               907.7632740817373, 0.1 + 0.2, 12345.678901234567, -3.5e-09]
+    for v in samples:
+        if float(format_c_float(v)) != v:
+            errors.append(f"format_c_float 有损: {v!r} -> {format_c_float(v)}")
+    return errors
+
+
+def check_roundtrip(table_text: str) -> list[str]:
+    errors: list[str] = []
+    rows, headers = parse_table(table_text)
+    if set(rows) != {name for name, _ in PRESET_ROWS}:
+        errors.append(f"表行缺失: {sorted(rows)}")
+        return errors
+
+    for preset_name, slug in JSON_SLUG_BY_PRESET.items():
+        json_path = resolve_preset_json(ROOT, slug)
+        if not json_path.exists():
+            errors.append(f"{preset_name}: 缺少 {json_path.name}")
+            continue
+        params, _ = load_preset_json(json_path)
+        row = list(rows[preset_name])
+        merge_json_into_row(row, params)
+
+        rendered = dict(rows)
+        rendered[preset_name] = row
+        back_rows, _ = parse_table(render_table(rendered, headers))
+        exported = row_to_json(back_rows[preset_name])
+
+        for key, value in params.items():
+            if key not in PARAM_FIELDS:
+                errors.append(f"{preset_name}: JSON 键 {key} 不在表列中")
+            elif exported[key] != value:
+                errors.append(f"{preset_name}.{key}: {value!r} -> {exported[key]!r}")
+        if back_rows[preset_name] != row:
+            errors.append(f"{preset_name}: 渲染后行内容变化")
+    return errors
+
+
+def check_in_sync(table_path: Path, table_text: str) -> list[str]:
+    json_by_preset = {
+        name: resolve_preset_json(ROOT, slug) for name, slug in JSON_SLUG_BY_PRESET.items()
+    }
+    regenerated, _ = embed(table_text, json_by_preset)
+    if regenerated != table_text:
+        return [f"{table_path.name} 与 JSON 不同步，请运行 tools/embed_json_to_c.py"]
+    return []
+
+
+def main() -> int:
+    table_path = NETWORK_CONFIG / "SCR_RSS_PresetTable.c"
+    table_text = table_path.read_text(encoding="utf-8")
+
+    failed = False
+    for name, check in (
+        ("layout", lambda: check_layout(table_text)),
+        ("literals", check_literals),
+        ("json roundtrip", lambda: check_roundtrip(table_text)),
+        ("table in sync", lambda: check_in_sync(table_path, table_text)),
+    ):
+        errors = check()
+        failed = failed or bool(errors)
+        print(f"[{'FAIL' if errors else 'PASS'}] {name}")
+        for err in errors:
+            print(f"    {err}")
+
+    if failed:
+        return 1
+    print("[OK] preset table round-trip checks passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
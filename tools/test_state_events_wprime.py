@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+OnWPrimeDepletedChanged 客户端路径：玩家体力 tick 在拥有者客户端跑，W′ 只在服务器推进，
+客户端本 tick 无 TickPower 快照，耗尽态须从复制池取（PlayerBase.RSS_IsWPrimeDepletedForEvents）。
+
+直接检查游戏脚本：
+1. SCR_RSS_StateEvents.Evaluate 的 W′ 参数来自 RSS_IsWPrimeDepletedForEvents，
+   其在无快照时依次回落到 CP 模型武装态、复制池；
+2. 复制池 RplProp 回调经 NetworkSyncManager → AnaerobicBurst → CriticalPowerModel.ApplyReplication
+   刷新施密特武装态（客户端边沿才会跟随服务器）；
+3. 复制量化步（SCR_RSS_WPrimeServerTick.REPL_POOL_STEPS）小于施密特带宽，满/空池精确落地，
+   复制值不会跨过整条带而漏掉一次武装切换。
+"""
+
+from __future__ import annotations
+
+import re
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from enforce_source import calls, method_body, read_script, static_const  # noqa: E402
+
+PLAYER_BASE = read_script("Integration/PlayerBase.c")
+
+
+def check_evaluate_uses_event_helper() -> bool:
+    body = method_body(PLAYER_BASE, "RSS_EvaluateStateEvents")
+    m = re.search(r"\.Evaluate\((.*?)\);", body, re.DOTALL)
+    if not m:
+        return False
+    args = [a.strip() for a in m.group(1).split(",")]
+    return len(args) == 6 and args[3] == "RSS_IsWPrimeDepletedForEvents()"
+
+
+def check_event_helper_fallbacks() -> bool:
+    body = method_body(PLAYER_BASE, "RSS_IsWPrimeDepletedForEvents")
+    snapshot = body.find("IsPostTickCaptured()")
+    cp_model = body.find("GetCpModel().IsOverspeedArmed()")
+    repl_pool = body.find("IsWPrimePoolAvailableForOverspeed(m_fReplAnaerobicPool)")
+    return 0 <= snapshot < cp_model < repl_pool
+
+
+def check_replication_refreshes_schmitt() -> bool:
+    if not re.search(
+        r'\[RplProp\(onRplName:\s*"OnRssAnaerobicReplicated"\)\]\s*protected float m_fReplAnaerobicPool\b',
+        PLAYER_BASE,
+    ):
+        return False
+    on_rpl = method_body(PLAYER_BASE, "OnRssAnaerobicReplicated")
+    if not calls(on_rpl, "SCR_RSS_NetworkSyncManager.ApplyAnaerobicReplication"):
+        return False
+    sync = read_script("RSS/NetworkConfig/SCR_RSS_NetworkSyncManager.c")
+    if not calls(method_body(sync, "ApplyAnaerobicReplication"), "burst.ApplyReplication"):
+        return False
+    burst = read_script("RSS/Core/SCR_RSS_AnaerobicBurst.c")
+    if not calls(method_body(burst, "ApplyReplication"), "m_pCpModel.ApplyReplication"):
+        return False
+    cp = read_script("RSS/Core/SCR_RSS_CriticalPowerModel.c")
+    return calls(method_body(cp, "ApplyReplication"), "RefreshAndGetOverspeedArmed")
+
+
+def check_quantum_inside_schmitt_band() -> bool:
+    constants = read_script("RSS/Core/SCR_RSS_Constants.c")
+    band = static_const(constants, "V6_WPRIME_OVERSPEED_REARM") - static_const(
+        constants, "V6_WPRIME_OVERSPEED_HYSTERESIS"
+    )
+    server_tick = read_script("RSS/Core/SCR_RSS_WPrimeServerTick.c")
+    quantum = 1.0 / static_const(server_tick, "REPL_POOL_STEPS")
+    changed = method_body(server_tick, "ReplicationChanged")
+    lands_exactly = "newPool >= 1.0" in changed and "newPool <= 0.0" in changed
+    return quantum < band and lands_exactly
+
+
+SCENARIOS = [
+    ("Evaluate 的 W′ 参数取 RSS_IsWPrimeDepletedForEvents", check_evaluate_uses_event_helper),
+    ("无快照时回落 CP 模型武装态、再回落复制池", check_event_helper_fallbacks),
+    ("复制池回调刷新施密特武装态", check_replication_refreshes_schmitt),
+    ("复制量化步小于施密特带宽且满/空池落地", check_quantum_inside_schmitt_band),
+]
+
+
+def main() -> int:
+    failed = 0
+    for name, fn in SCENARIOS:
+        try:
+            ok = fn()
+        except (KeyError, ValueError) as exc:
+            print(f"  [FAIL] {name}: {exc}")
+            failed += 1
+            continue
+        if ok:
+            print(f"  [PASS] {name}")
+        else:
+            print(f"  [FAIL] {name}")
+            failed += 1
+    if failed:
+        print(f"test_state_events_wprime: {failed} failure(s)")
+        return 1
+    print(f"test_state_events_wprime: {len(SCENARIOS)}/{len(SCENARIOS)} passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+SCR_RSS_VehicleRecovery 对照：1 Hz 解析推进 vs 逐 tick 欧拉（玩家 17 ms）与细步长参考。
+
+解析推进是 SCR_RSS_VehicleRecovery.c（RawPerTick / Advance）的转写；保底常量从脚本读取，
+分段断点与 RawPerTick 的保底/上限顺序直接对照脚本，脚本改动而此处未跟上时失败。
+"""
+
+from __future__ import annotations
+
+import math
+import re
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from enforce_source import method_body, read_script, static_const  # noqa: E402
+
+VEHICLE_RECOVERY = read_script("RSS/Core/SCR_RSS_VehicleRecovery.c")
+
+DESPERATION_STAMINA = static_const(VEHICLE_RECOVERY, "DESPERATION_STAMINA")
+DESPERATION_FLOOR_PER_TICK = static_const(VEHICLE_RECOVERY, "DESPERATION_FLOOR_PER_TICK")
+STATIC_FLOOR_TRIGGER_PER_TICK = static_const(VEHICLE_RECOVERY, "STATIC_FLOOR_TRIGGER_PER_TICK")
+MAX_SEGMENTS = int(static_const(VEHICLE_RECOVERY, "MAX_SEGMENTS"))
+
+# Prepare 中 AddBreak 的参数；VehicleRecovery 按同一张表求断点
+BREAK_EXPRESSIONS = (
+    "DESPERATION_STAMINA",
+    "m_fBlockedBelow",
+    "m_fDecayThreshold",
+    "m_fDecayCoeff - 1.0",
+    "m_fDecayCoeff - 0.2",
+    "FormulaCrossing(STATIC_FLOOR_TRIGGER_PER_TICK)",
+    "FormulaCrossing(DESPERATION_FLOOR_PER_TICK)",
+    "FormulaCrossing(m_fMaxPerTick)",
+)
+
+# VehicleRecovery.raw_per_tick 的判定顺序
+RAW_PER_TICK_GUARDS = (
+    r"if \(s >= m_fBlockedBelow\)\s*raw = Formula\(s\);",
+    r"if \(s < DESPERATION_STAMINA\)\s*raw = Math\.Max\(raw, DESPERATION_FLOOR_PER_TICK\);",
+    r"if \(raw < STATIC_FLOOR_TRIGGER_PER_TICK\)\s*raw = DESPERATION_FLOOR_PER_TICK;",
+    r"if \(m_fMaxPerTick > 0\.0 && raw > m_fMaxPerTick\)\s*raw = m_fMaxPerTick;",
+)
+
+# 解析推进与 2 ms 欧拉参考的最大偏差；与逐 tick 路径（17 ms）在 5 分钟乘车内的最大偏差
+TOL_VS_REFERENCE = 1e-5
+TOL_VS_PLAYER_TICK = 2e-4
+
+
+class VehicleRecovery:
+    def __init__(self, gain, nonlinear=0.5, decay_threshold=0.8, decay_coeff=1.1,
+                 max_per_tick=0.0004, custom=1.0, blocked_below=-1.0):
+        self.gain = gain
+        self.a = nonlinear
+        self.th = decay_threshold
+        self.c = decay_coeff
+        self.max_per_tick = max_per_tick
+        self.scale = 5.0 * custom
+        self.blocked_below = blocked_below
+        self.breaks = sorted(b for b in map(self._break_value, BREAK_EXPRESSIONS) if 0.0 < b < 1.0)
+
+    def _break_value(self, expr):
+        fields = {
+            "DESPERATION_STAMINA": DESPERATION_STAMINA,
+            "STATIC_FLOOR_TRIGGER_PER_TICK": STATIC_FLOOR_TRIGGER_PER_TICK,
+            "DESPERATION_FLOOR_PER_TICK": DESPERATION_FLOOR_PER_TICK,
+            "m_fBlockedBelow": self.blocked_below,
+            "m_fDecayThreshold": self.th,
+            "m_fDecayCoeff": self.c,
+            "m_fMaxPerTick": self.max_per_tick,
+        }
+        m = re.fullmatch(r"FormulaCrossing\((\w+)\)", expr)
+        if m:
+            per_tick = fields[m.group(1)]
+            # 脚本里 m_fMaxPerTick 的交点只在上限生效时加入
+            return self._crossing(per_tick) if per_tick > 0.0 else -1.0
+        m = re.fullmatch(r"(\w+)(?: - ([\d.]+))?", expr)
+        return fields[m.group(1)] - float(m.group(2) or 0.0)
+
+    def formula(self, s):
+        m = 1.0
+        if s > self.th:
+            m = min(max(self.c - s, 0.2), 1.0)
+        return self.gain * (1.0 + self.a * (1.0 - s)) * m
+
+    def _crossing(self, per_tick):
+        if self.formula(0.0) < per_tick or self.formula(1.0) > per_tick:
+            return -1.0
+        lo, hi = 0.0, 1.0
+        for _ in range(24):
+            mid = 0.5 * (lo + hi)
+            if self.formula(mid) > per_tick:
+                lo = mid
+            else:
+                hi = mid
+        return 0.5 * (lo + hi)
+
+    def raw_per_tick(self, s):
+        s = min(max(s, 0.0), 1.0)
+        raw = self.formula(s) if s >= self.blocked_below else 0.0
+        if s < DESPERATION_STAMINA:
+            raw = max(raw, DESPERATION_FLOOR_PER_TICK)
+        if raw < STATIC_FLOOR_TRIGGER_PER_TICK:
+            raw = DESPERATION_FLOOR_PER_TICK
+        if self.max_per_tick > 0.0 and raw > self.max_per_tick:
+            raw = self.max_per_tick
+        return raw
+
+    def rate_per_second(self, s):
+        return self.raw_per_tick(s) * self.scale
+
+    def _next_break(self, s, cap):
+        for b in self.breaks:
+            if s + 1e-6 < b < cap:
+                return b
+        return cap
+
+    def _linear(self, law, k, m):
+        if law == "quadratic":
+            return k * self.c, k
+        return k * m * (1.0 + self.a), k * m * self.a
+
+    def _true_quadratic(self, law, k):
+        return law == "quadratic" and self.a > 1e-6 and k > 0.0
+
+    def _time_to(self, law, s0, s1, rate, k, m):
+        if self._true_quadratic(law, k):
+            a, c = self.a, self.c
+            sigma = (1.0 + a) / a
+            if abs(sigma - c) < 1e-6:
+                return (1.0 / (c - s1) - 1.0 / (c - s0)) / (a * k)
+            q0 = (sigma - s0) / (c - s0)
+            q1 = (sigma - s1) / (c - s1)
+            return math.log(q1 / q0) / (a * k * (sigma - c))
+        if law != "constant":
+            ca, cb = self._linear(law, k, m)
+            if cb > 0.0:
+                return math.log((ca - cb * s0) / (ca - cb * s1)) / cb
+            rate = ca
+        return 1e6 if rate <= 0.0 else (s1 - s0) / rate
+
+    def _evolve(self, law, s0, t, rate, k, m):
+        if self._true_quadratic(law, k):
+            a, c = self.a, self.c
+            sigma = (1.0 + a) / a
+            if abs(sigma - c) < 1e-6:
+                return c - 1.0 / (1.0 / (c - s0) + a * k * t)
+            q = (sigma - s0) / (c - s0) * math.exp(a * k * (sigma - c) * t)
+            return (sigma - q * c) / (1.0 - q)
+        if law != "constant":
+            ca, cb = self._linear(law, k, m)
+            if cb > 0.0:
+                sig = ca / cb
+                return sig - (sig - s0) * math.exp(-cb * t)
+            rate = ca
+        return s0 + rate * t
+
+    def advance(self, s, dt, cap):
+        remaining = dt
+        k = self.gain * self.scale
+        for _ in range(MAX_SEGMENTS):
+            if remaining <= 0.0 or s >= cap:
+                break
+            nxt = self._next_break(s, cap)
+            probe = 0.5 * (s + nxt)
+            law, m = "constant", 1.0
+            rate = self.rate_per_second(probe)
+            if probe >= self.blocked_below and self.raw_per_tick(probe) == self.formula(probe):
+                law = "linear"
+                if probe > self.th:
+                    m = self.c - probe
+                    if 0.2 < m < 1.0:
+                        law = "quadratic"
+                    else:
+                        m = min(max(m, 0.2), 1.0)
+            t_next = self._time_to(law, s, nxt, rate, k, m)
+            if t_next >= remaining:
+                return min(self._evolve(law, s, remaining, rate, k, m), cap)
+            s = nxt
+            remaining -= t_next
+        return min(s, cap)
+
+
+def euler(model, s, duration, step, cap):
+    t = 0.0
+    while t < duration - 1e-9:
+        h = min(step, duration - t)
+        s = min(s + model.rate_per_second(s) * h, cap)
+        t += h
+    return s
+
+
+MODELS = {
+    "default": VehicleRecovery(gain=0.00022),
+    "capped": VehicleRecovery(gain=0.0005),
+    "slow_blocked": VehicleRecovery(gain=0.00006, blocked_below=0.2),
+    "custom_x2.5": VehicleRecovery(gain=0.00022, custom=2.5),
+    "linear_only": VehicleRecovery(gain=0.0003, nonlinear=0.0),
+}
+
+
+def check_breaks_match_script() -> bool:
+    prepare = method_body(VEHICLE_RECOVERY, "Prepare")
+    found = tuple(a.strip() for a in re.findall(r"AddBreak\((.*)\);", prepare))
+    if found != BREAK_EXPRESSIONS:
+        print(f"    script breaks {found}")
+        return False
+    return True
+
+
+def check_raw_per_tick_order() -> bool:
+    body = method_body(VEHICLE_RECOVERY, "RawPerTick")
+    pos = -1
+    for guard in RAW_PER_TICK_GUARDS:
+        m = re.compile(guard).search(body, pos + 1)
+        if not m:
+            print(f"    RawPerTick guard missing or out of order: {guard}")
+            return False
+        pos = m.start()
+    return True
+
+
+def _check_model(model: VehicleRecovery) -> bool:
+    starts = [0.0, 0.15, 0.79, 0.86, 0.95]
+    caps = [1.0, 0.7]
+    ride_sec = 300
+    worst_ref = 0.0
+    worst_tick = 0.0
+    for s0 in starts:
+        for cap in caps:
+            if s0 >= cap:
+                continue
+            s_fast = s0
+            s_ref = s0
+            s_tick = s0
+            for _ in range(ride_sec):
+                s_fast = model.advance(s_fast, 1.0, cap)
+                s_ref = euler(model, s_ref, 1.0, 0.002, cap)
+                s_tick = euler(model, s_tick, 1.0, 0.017, cap)
+                worst_ref = max(worst_ref, abs(s_fast - s_ref))
+                worst_tick = max(worst_tick, abs(s_fast - s_tick))
+    print(f"    vs 2ms ref {worst_ref:.2e}, vs 17ms tick {worst_tick:.2e}")
+    return worst_ref <= TOL_VS_REFERENCE and worst_tick <= TOL_VS_PLAYER_TICK
+
+
+def check_interval_split() -> bool:
+    # 单次 2 s 推进（卡顿截断上限）与两次 1 s 推进一致
+    model = MODELS["default"]
+    one = model.advance(0.5, 2.0, 1.0)
+    two = model.advance(model.advance(0.5, 1.0, 1.0), 1.0, 1.0)
+    return abs(one - two) <= 1e-9
+
+
+SCENARIOS = [
+    ("分段断点与脚本 Prepare 一致", check_breaks_match_script),
+    ("保底/上限顺序与脚本 RawPerTick 一致", check_raw_per_tick_order),
+] + [
+    (f"解析推进 vs 欧拉：{name}", lambda model=model: _check_model(model)) for name, model in MODELS.items()
+] + [
+    ("2 s 推进等于两次 1 s", check_interval_split),
+]
+
+
+def main() -> int:
+    failed = 0
+    for name, fn in SCENARIOS:
+        try:
+            ok = fn()
+        except (KeyError, ValueError) as exc:
+            print(f"  [FAIL] {name}: {exc}")
+            failed += 1
+            continue
+        if ok:
+            print(f"  [PASS] {name}")
+        else:
+            print(f"  [FAIL] {name}")
+            failed += 1
+    if failed:
+        print(f"test_vehicle_recovery: {failed} failure(s)")
+        return 1
+    print(f"test_vehicle_recovery: {len(SCENARIOS)}/{len(SCENARIOS)} passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())